@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// Offline screenshot comparison. Compares every PNG in a folder of captured screenshots against the baseline with the same
+// relative path, using the same scoring and tolerance levels as the ScriptReporter in AtomSampleViewer, so the comparison
+// can run on machines without a GPU after the screenshots were captured elsewhere.
+//
+// Usage:
+//   AtomSampleViewer.ImageCompare --screenshots <folder> --baselines <folder> [options]
+//     --output <folder>              Where the report and diff images are written. Defaults to the screenshots folder.
+//     --config <file>                ImageComparisonConfig.azasset with the tolerance levels. Defaults to the project's Config folder.
+//     --toleranceLevel <name>        Tolerance level for screenshots not listed in the manifest. Defaults to the strictest level.
+//     --toleranceManifest <file>     JSON object mapping screenshot paths, relative to the screenshots folder, to tolerance level
+//                                    names. A key ending with '/' applies to everything in that folder. The longest match wins.
+//     --baselineCache <folder>       Keeps decoded baselines in this folder so later runs don't decode them again.
+//     --exportAllDiffs               Write diff images for passing screenshots too.
+//
+// Returns 0 if all screenshots pass, 1 if any fail, and 2 if the comparison could not run.
+
+#include <Automation/BaselineImageCache.h>
+#include <Automation/ImageComparisonConfig.h>
+#include <Automation/ImageDiff.h>
+#include <Automation/ScreenshotComparison.h>
+
+#include <Atom/Utils/PngFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Settings/CommandLine.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+
+namespace AtomSampleViewer
+{
+    namespace ImageCompare
+    {
+        static constexpr const char* LogWindow = "ImageCompare";
+        static constexpr const char* ReportFileName = "imageCompareResults.txt";
+
+        enum ExitCode
+        {
+            ExitCode_Pass = 0,
+            ExitCode_Fail = 1,
+            ExitCode_Error = 2
+        };
+
+        struct ScreenshotResult
+        {
+            AZStd::string m_relativePath;
+            AZStd::string m_screenshotFilePath;
+            AZStd::string m_baselineFilePath;
+            const ImageComparisonToleranceLevel* m_toleranceLevel = nullptr;
+            ScreenshotComparison::Result m_result = ScreenshotComparison::Result::FileNotLoaded;
+            float m_diffScore = 0.0f;
+            bool m_passed = false;
+            AZStd::string m_diffImagePath;
+        };
+
+        struct Options
+        {
+            AZStd::string m_screenshotFolder;
+            AZStd::string m_baselineFolder;
+            AZStd::string m_outputFolder;
+            AZStd::string m_configFilePath;
+            AZStd::string m_toleranceLevelName;
+            AZStd::string m_toleranceManifestPath;
+            AZStd::string m_baselineCacheFolder;
+            bool m_exportAllDiffs = false;
+        };
+
+        static AZStd::string GetSwitch(const AZ::CommandLine& commandLine, const char* name)
+        {
+            return commandLine.HasSwitch(name) ? commandLine.GetSwitchValue(name, 0) : AZStd::string();
+        }
+
+        static bool ParseOptions(const AZ::CommandLine& commandLine, Options& options)
+        {
+            options.m_screenshotFolder = GetSwitch(commandLine, "screenshots");
+            options.m_baselineFolder = GetSwitch(commandLine, "baselines");
+            options.m_outputFolder = GetSwitch(commandLine, "output");
+            options.m_configFilePath = GetSwitch(commandLine, "config");
+            options.m_toleranceLevelName = GetSwitch(commandLine, "toleranceLevel");
+            options.m_toleranceManifestPath = GetSwitch(commandLine, "toleranceManifest");
+            options.m_baselineCacheFolder = GetSwitch(commandLine, "baselineCache");
+            options.m_exportAllDiffs = commandLine.HasSwitch("exportAllDiffs");
+
+            if (options.m_screenshotFolder.empty() || options.m_baselineFolder.empty())
+            {
+                AZ_Error(LogWindow, false, "Usage: AtomSampleViewer.ImageCompare --screenshots <folder> --baselines <folder> [--output <folder>] "
+                    "[--config <file>] [--toleranceLevel <name>] [--toleranceManifest <file>] [--baselineCache <folder>] [--exportAllDiffs]");
+                return false;
+            }
+
+            if (options.m_outputFolder.empty())
+            {
+                options.m_outputFolder = options.m_screenshotFolder;
+            }
+
+            if (options.m_configFilePath.empty())
+            {
+                AzFramework::StringFunc::Path::Join(AZ::Utils::GetProjectPath().c_str(), "Config/ImageComparisonConfig.azasset", options.m_configFilePath);
+            }
+
+            return true;
+        }
+
+        //! Reads the tolerance levels from an ImageComparisonConfig.azasset, which wraps the config in an AnyAsset.
+        static bool LoadConfig(const AZStd::string& filePath, ImageComparisonConfig& config)
+        {
+            auto readOutcome = AZ::JsonSerializationUtils::ReadJsonFile(filePath);
+            if (!readOutcome.IsSuccess())
+            {
+                AZ_Error(LogWindow, false, "Failed to read '%s': %s", filePath.c_str(), readOutcome.GetError().c_str());
+                return false;
+            }
+
+            const rapidjson::Document& document = readOutcome.GetValue();
+            auto classData = document.FindMember("ClassData");
+            if (classData == document.MemberEnd())
+            {
+                AZ_Error(LogWindow, false, "'%s' is not an ImageComparisonConfig asset.", filePath.c_str());
+                return false;
+            }
+
+            const AZ::JsonSerializationResult::ResultCode result = AZ::JsonSerialization::Load(config, classData->value);
+            if (result.GetProcessing() == AZ::JsonSerializationResult::Processing::Halted || config.m_toleranceLevels.empty())
+            {
+                AZ_Error(LogWindow, false, "Failed to load the tolerance levels from '%s'.", filePath.c_str());
+                return false;
+            }
+
+            return true;
+        }
+
+        static const ImageComparisonToleranceLevel* FindToleranceLevel(const ImageComparisonConfig& config, const AZStd::string& name)
+        {
+            for (const ImageComparisonToleranceLevel& level : config.m_toleranceLevels)
+            {
+                if (level.m_name == name)
+                {
+                    return &level;
+                }
+            }
+            AZ_Error(LogWindow, false, "Tolerance level '%s' is not in the ImageComparisonConfig.", name.c_str());
+            return nullptr;
+        }
+
+        //! Maps relative screenshot paths, or folder prefixes ending with '/', to tolerance levels.
+        using ToleranceManifest = AZStd::vector<AZStd::pair<AZStd::string, const ImageComparisonToleranceLevel*>>;
+
+        static bool LoadToleranceManifest(const AZStd::string& filePath, const ImageComparisonConfig& config, ToleranceManifest& manifest)
+        {
+            auto readOutcome = AZ::JsonSerializationUtils::ReadJsonFile(filePath);
+            if (!readOutcome.IsSuccess() || !readOutcome.GetValue().IsObject())
+            {
+                AZ_Error(LogWindow, false, "Failed to read tolerance manifest '%s'.", filePath.c_str());
+                return false;
+            }
+
+            for (const auto& member : readOutcome.GetValue().GetObject())
+            {
+                if (!member.value.IsString())
+                {
+                    AZ_Error(LogWindow, false, "Tolerance manifest entry '%s' must be a tolerance level name.", member.name.GetString());
+                    return false;
+                }
+
+                const ImageComparisonToleranceLevel* level = FindToleranceLevel(config, member.value.GetString());
+                if (!level)
+                {
+                    return false;
+                }
+                manifest.emplace_back(member.name.GetString(), level);
+            }
+
+            // Longest keys first, so the first match is the most specific one
+            AZStd::sort(manifest.begin(), manifest.end(), [](const auto& a, const auto& b) { return a.first.size() > b.first.size(); });
+            return true;
+        }
+
+        static const ImageComparisonToleranceLevel* FindToleranceLevel(
+            const ToleranceManifest& manifest, const AZStd::string& relativePath, const ImageComparisonToleranceLevel* defaultLevel)
+        {
+            for (const auto& [key, level] : manifest)
+            {
+                const bool isFolder = !key.empty() && key.back() == '/';
+                if (isFolder ? relativePath.starts_with(key) : relativePath == key)
+                {
+                    return level;
+                }
+            }
+            return defaultLevel;
+        }
+
+        //! Adds every PNG under the folder to the results, with paths relative to the root folder.
+        static void FindScreenshots(const AZStd::string& rootFolder, const AZStd::string& relativeFolder, AZStd::vector<ScreenshotResult>& results)
+        {
+            auto io = AZ::IO::LocalFileIO::GetInstance();
+
+            AZStd::string folder;
+            AzFramework::StringFunc::Path::Join(rootFolder.c_str(), relativeFolder.c_str(), folder);
+
+            io->FindFiles(folder.c_str(), "*", [&](const char* filePath)
+                {
+                    AZStd::string fileName;
+                    AzFramework::StringFunc::Path::GetFullFileName(filePath, fileName);
+                    const AZStd::string relativePath = relativeFolder.empty() ? fileName : relativeFolder + "/" + fileName;
+
+                    if (io->IsDirectory(filePath))
+                    {
+                        FindScreenshots(rootFolder, relativePath, results);
+                    }
+                    else if (AzFramework::StringFunc::Path::IsExtension(filePath, "png"))
+                    {
+                        results.emplace_back().m_relativePath = relativePath;
+                    }
+                    return true;
+                });
+        }
+
+        static AZStd::string GetDiffImagePath(const AZStd::string& outputFolder, const AZStd::string& relativePath)
+        {
+            AZStd::string flattenedName = relativePath;
+            AzFramework::StringFunc::Path::StripExtension(flattenedName);
+            AZStd::replace(flattenedName.begin(), flattenedName.end(), '/', '_');
+
+            AZStd::string diffImagePath;
+            AzFramework::StringFunc::Path::Join(outputFolder.c_str(), ("imageDiff_" + flattenedName + ".png").c_str(), diffImagePath);
+            return diffImagePath;
+        }
+
+        static void CompareScreenshot(ScreenshotResult& result, BaselineImageCache& baselineImageCache, const Options& options)
+        {
+            ScreenshotComparison comparison(result.m_screenshotFilePath, baselineImageCache);
+            const ScreenshotComparison::Outcome outcome = comparison.CompareWithBaseline(result.m_baselineFilePath);
+
+            result.m_result = outcome.m_result;
+            if (outcome.m_result != ScreenshotComparison::Result::Compared)
+            {
+                return;
+            }
+
+            // Must match the score selection in ScriptReporter::FinishScreenshotCheck
+            result.m_diffScore = result.m_toleranceLevel->m_filterImperceptibleDiffs
+                ? outcome.m_scores.m_diffScore
+                : outcome.m_scores.m_filteredDiffScore;
+            result.m_passed = result.m_diffScore <= result.m_toleranceLevel->m_threshold;
+
+            if (!result.m_passed || options.m_exportAllDiffs)
+            {
+                AZStd::shared_ptr<const BaselineImageCache::Image> screenshot = comparison.GetScreenshot();
+                if (screenshot)
+                {
+                    using namespace AZ::Utils;
+                    PngFile diffImage = PngFile::Create(
+                        AZ::RHI::Size(screenshot->m_width, screenshot->m_height * 3, 1),
+                        AZ::RHI::Format::R8G8B8A8_UNORM,
+                        ImageDiff::CreateDiffReportImage(outcome.m_baseline->GetPixels(), screenshot->GetPixels()));
+
+                    result.m_diffImagePath = GetDiffImagePath(options.m_outputFolder, result.m_relativePath);
+                    if (!diffImage.Save(result.m_diffImagePath.c_str()))
+                    {
+                        AZ_Warning(LogWindow, false, "Failed to save diff image '%s'.", result.m_diffImagePath.c_str());
+                        result.m_diffImagePath.clear();
+                    }
+                }
+            }
+        }
+
+        static AZStd::string GetSummaryString(const ScreenshotResult& result)
+        {
+            if (result.m_result == ScreenshotComparison::Result::Compared)
+            {
+                return AZStd::string::format("Diff Score: %f", result.m_diffScore);
+            }
+            return ScreenshotComparison::ToString(result.m_result);
+        }
+
+        //! Writes the report in the same layout as ScriptReporter::ExportTestResults.
+        static bool WriteReport(const AZStd::string& filePath, const AZStd::vector<ScreenshotResult>& results, AZ::u32 failureCount)
+        {
+            AZStd::string report;
+            report += AZStd::string::format("Screenshot errors: %u \n", failureCount);
+            report += "\nScreenshot test info below.\n";
+
+            for (const ScreenshotResult& result : results)
+            {
+                report += AZStd::string::format("\n%s %s \n", result.m_passed ? "PASSED" : "FAILED", result.m_relativePath.c_str());
+                report += AZStd::string::format("Test screenshot path: %s \n", result.m_screenshotFilePath.c_str());
+                report += AZStd::string::format("Official baseline screenshot path: %s \n", result.m_baselineFilePath.c_str());
+                report += AZStd::string::format("Tolerance level: %s \n", result.m_toleranceLevel->ToString().c_str());
+                report += AZStd::string::format("Image comparison result: %s \n", GetSummaryString(result).c_str());
+                if (!result.m_diffImagePath.empty())
+                {
+                    report += AZStd::string::format("Image diff path: %s \n", result.m_diffImagePath.c_str());
+                }
+            }
+
+            return AZ::Utils::WriteFile(report, filePath).IsSuccess();
+        }
+
+        static int Run(const AZ::CommandLine& commandLine)
+        {
+            Options options;
+            if (!ParseOptions(commandLine, options))
+            {
+                return ExitCode_Error;
+            }
+
+            ImageComparisonConfig config;
+            if (!LoadConfig(options.m_configFilePath, config))
+            {
+                return ExitCode_Error;
+            }
+
+            const ImageComparisonToleranceLevel* defaultLevel = options.m_toleranceLevelName.empty()
+                ? &config.m_toleranceLevels.front()
+                : FindToleranceLevel(config, options.m_toleranceLevelName);
+            if (!defaultLevel)
+            {
+                return ExitCode_Error;
+            }
+
+            ToleranceManifest manifest;
+            if (!options.m_toleranceManifestPath.empty() && !LoadToleranceManifest(options.m_toleranceManifestPath, config, manifest))
+            {
+                return ExitCode_Error;
+            }
+
+            auto io = AZ::IO::LocalFileIO::GetInstance();
+            if (!io->IsDirectory(options.m_screenshotFolder.c_str()) || !io->IsDirectory(options.m_baselineFolder.c_str()))
+            {
+                AZ_Error(LogWindow, false, "The screenshots folder '%s' and baselines folder '%s' must exist.",
+                    options.m_screenshotFolder.c_str(), options.m_baselineFolder.c_str());
+                return ExitCode_Error;
+            }
+            io->CreatePath(options.m_outputFolder.c_str());
+
+            AZStd::vector<ScreenshotResult> results;
+            FindScreenshots(options.m_screenshotFolder, "", results);
+            AZStd::sort(results.begin(), results.end(), [](const ScreenshotResult& a, const ScreenshotResult& b) { return a.m_relativePath < b.m_relativePath; });
+
+            for (ScreenshotResult& result : results)
+            {
+                AzFramework::StringFunc::Path::Join(options.m_screenshotFolder.c_str(), result.m_relativePath.c_str(), result.m_screenshotFilePath);
+                AzFramework::StringFunc::Path::Join(options.m_baselineFolder.c_str(), result.m_relativePath.c_str(), result.m_baselineFilePath);
+                result.m_toleranceLevel = FindToleranceLevel(manifest, result.m_relativePath, defaultLevel);
+            }
+
+            // Each baseline is used once, so only sidecars are worth keeping, and only if a cache folder was given
+            BaselineImageCache baselineImageCache;
+            baselineImageCache.Configure(0, options.m_baselineCacheFolder);
+
+            // One job per screenshot; the scoring inside each job is split into more jobs for large images
+            AZ::JobCompletion completion;
+            for (ScreenshotResult& result : results)
+            {
+                ScreenshotResult* resultPtr = &result;
+                AZ::Job* job = AZ::CreateJobFunction([resultPtr, &baselineImageCache, &options]()
+                    {
+                        CompareScreenshot(*resultPtr, baselineImageCache, options);
+                    }, true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+
+            AZ::u32 failureCount = 0;
+            for (const ScreenshotResult& result : results)
+            {
+                if (!result.m_passed)
+                {
+                    ++failureCount;
+                    AZ_Printf(LogWindow, "FAILED %s: %s (%s)\n", result.m_relativePath.c_str(), GetSummaryString(result).c_str(), result.m_toleranceLevel->ToString().c_str());
+                }
+            }
+
+            AZStd::string reportPath;
+            AzFramework::StringFunc::Path::Join(options.m_outputFolder.c_str(), ReportFileName, reportPath);
+            if (!WriteReport(reportPath, results, failureCount))
+            {
+                AZ_Error(LogWindow, false, "Failed to write '%s'.", reportPath.c_str());
+                return ExitCode_Error;
+            }
+
+            AZ_Printf(LogWindow, "%zu screenshots compared, %u failed. Results exported to %s\n", results.size(), failureCount, reportPath.c_str());
+            return failureCount == 0 ? ExitCode_Pass : ExitCode_Fail;
+        }
+
+    } // namespace ImageCompare
+} // namespace AtomSampleViewer
+
+int main(int argc, char** argv)
+{
+    AzFramework::Application application(&argc, &argv);
+
+    AZ::ComponentApplication::StartupParameters startupParameters;
+    startupParameters.m_loadDynamicModules = false;
+    application.Start(AzFramework::Application::Descriptor(), startupParameters);
+
+    AtomSampleViewer::ImageComparisonConfig::Reflect(application.GetSerializeContext());
+
+    const int exitCode = AtomSampleViewer::ImageCompare::Run(*application.GetAzCommandLine());
+
+    application.Stop();
+    return exitCode;
+}
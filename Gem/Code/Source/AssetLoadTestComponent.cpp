@@ -17,6 +17,7 @@
 #include <Automation/ScriptRunnerBus.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 #include <RHI/BasicRHIComponent.h>
 
@@ -123,13 +124,18 @@ namespace AtomSampleViewer
         m_modelInstanceData.reserve(instanceCount);
     }
 
-    void AssetLoadTestComponent::CreateLatticeInstance(const AZ::Transform& transform)
+    void AssetLoadTestComponent::CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms)
     {
-        m_modelInstanceData.emplace_back<ModelInstanceData>({});
-        ModelInstanceData& data = m_modelInstanceData.back();
-        data.m_modelAssetId = GetRandomModelId();
-        data.m_materialAssetId = GetRandomMaterialId();
-        data.m_transform = transform;
+        const size_t firstInstance = m_modelInstanceData.size();
+        m_modelInstanceData.resize(firstInstance + transforms.size());
+
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            ModelInstanceData& data = m_modelInstanceData[firstInstance + i];
+            data.m_modelAssetId = GetRandomModelId();
+            data.m_materialAssetId = GetRandomMaterialId();
+            data.m_transform = transforms[i];
+        }
     }
 
     void AssetLoadTestComponent::FinalizeLatticeInstances()
@@ -173,23 +179,38 @@ namespace AtomSampleViewer
 
     void AssetLoadTestComponent::OnAllAssetsReadyActivate()
     {
+        // The instances share a handful of models and materials, so resolve each of them once before acquiring the meshes
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::Instance<AZ::RPI::Material>> materialInstances;
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::Asset<AZ::RPI::ModelAsset>> modelAssets;
+
         for (ModelInstanceData& instanceData : m_modelInstanceData)
         {
             AZ::Data::Instance<AZ::RPI::Material> materialInstance;
             if (instanceData.m_materialAssetId.IsValid())
             {
-                AZ::Data::Asset<RPI::MaterialAsset> materialAsset;
-                materialAsset.Create(instanceData.m_materialAssetId, true);
-                materialInstance = AZ::RPI::Material::FindOrCreate(materialAsset);
+                auto [materialIter, inserted] = materialInstances.try_emplace(instanceData.m_materialAssetId);
+                if (inserted)
+                {
+                    AZ::Data::Asset<RPI::MaterialAsset> materialAsset;
+                    materialAsset.Create(instanceData.m_materialAssetId, true);
+                    materialIter->second = AZ::RPI::Material::FindOrCreate(materialAsset);
 
-                // cache the material when its loaded
-                m_cachedMaterials.insert(materialAsset);
+                    // cache the material when its loaded
+                    m_cachedMaterials.insert(materialAsset);
+                }
+                materialInstance = materialIter->second;
             }
 
             if (instanceData.m_modelAssetId.IsValid())
             {
+                auto [modelIter, inserted] = modelAssets.try_emplace(instanceData.m_modelAssetId);
+                if (inserted)
+                {
+                    modelIter->second.Create(instanceData.m_modelAssetId, true);
+                }
+
                 AZ::Render::MeshHandleDescriptor descriptor;
-                descriptor.m_modelAsset.Create(instanceData.m_modelAssetId, true);
+                descriptor.m_modelAsset = modelIter->second;
                 descriptor.m_customMaterials[AZ::Render::DefaultCustomMaterialId].m_material = materialInstance;
                 instanceData.m_meshHandle = GetMeshFeatureProcessor()->AcquireMesh(descriptor);
                 GetMeshFeatureProcessor()->SetTransform(instanceData.m_meshHandle, instanceData.m_transform);
@@ -50,7 +50,7 @@ namespace AtomSampleViewer
 
         //! EntityLatticeTestComponent overrides...
         void PrepareCreateLatticeInstances(uint32_t instanceCount) override;
-        void CreateLatticeInstance(const AZ::Transform& transform) override;
+        void CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms) override;
         void FinalizeLatticeInstances() override;
         void DestroyLatticeInstances() override;
 
@@ -8,6 +8,7 @@
 
 #include <AtomSampleViewerSystemComponent.h>
 #include <Automation/ImageComparisonConfig.h>
+#include <Automation/ScriptReporter.h>
 
 #include <EntityLatticeTestComponent.h>
 
@@ -30,6 +31,8 @@
 #include <ISystem.h>
 #include <IConsole.h>
 
+#include <Utils/BenchmarkHarness.h>
+#include <Utils/CameraPath.h>
 #include <Utils/ImGuiAssetBrowser.h>
 #include <Utils/ImGuiSidebar.h>
 #include <Utils/ImGuiSaveFilePath.h>
@@ -52,8 +55,11 @@ namespace AtomSampleViewer
         ImGuiAssetBrowser::Reflect(context);
         ImGuiSidebar::Reflect(context);
         ImGuiSaveFilePath::Reflect(context);
+        BenchmarkHarness::Reflect(context);
+        CameraPath::Reflect(context);
 
         ImageComparisonConfig::Reflect(context);
+        ScriptReporter::Reflect(context);
 
         // Abstract base components is used by multiple components and needs to be reflected in a single location.
         CommonSampleComponentBase::Reflect(context);
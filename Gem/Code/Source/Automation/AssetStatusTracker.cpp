@@ -7,26 +7,131 @@
  */
 
 #include <Automation/AssetStatusTracker.h>
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 
 namespace AtomSampleViewer
 {
+    void AssetStatusTracker::EventQueue::Initialize(size_t capacity)
+    {
+        AZ_Assert(capacity > 0, "The asset event queue needs at least one slot");
+        m_slots.reset(new Slot[capacity]);
+        m_capacity = capacity;
+        for (size_t i = 0; i < m_capacity; ++i)
+        {
+            m_slots[i].m_sequence.store(i, AZStd::memory_order_relaxed);
+        }
+        m_tail.store(0, AZStd::memory_order_relaxed);
+        m_head = 0;
+    }
+
+    bool AssetStatusTracker::EventQueue::TryPush(const AssetEvent& event)
+    {
+        size_t tail = m_tail.load(AZStd::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = m_slots[tail % m_capacity];
+            const size_t sequence = slot.m_sequence.load(AZStd::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(tail);
+
+            if (difference == 0)
+            {
+                // The slot is free for this position. Claim it, or try again from the new tail if another producer got it first.
+                if (m_tail.compare_exchange_weak(tail, tail + 1, AZStd::memory_order_relaxed))
+                {
+                    slot.m_event = event;
+                    slot.m_sequence.store(tail + 1, AZStd::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                // The consumer hasn't read this slot since the last lap
+                return false;
+            }
+            else
+            {
+                tail = m_tail.load(AZStd::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool AssetStatusTracker::EventQueue::TryPop(AssetEvent& event)
+    {
+        if (!IsInitialized())
+        {
+            return false;
+        }
+
+        Slot& slot = m_slots[m_head % m_capacity];
+        if (slot.m_sequence.load(AZStd::memory_order_acquire) != m_head + 1)
+        {
+            return false;
+        }
+
+        event = slot.m_event;
+        slot.m_sequence.store(m_head + m_capacity, AZStd::memory_order_release);
+        ++m_head;
+        return true;
+    }
+
+    uint32_t AssetStatusTracker::AssetStatusEvents::GetActiveJobCount() const
+    {
+        const uint32_t finished = m_succeeded + m_failed;
+        return m_started > finished ? m_started - finished : 0;
+    }
+
+    AssetStatusTracker::AssetStatusTracker(size_t eventQueueCapacity)
+        : m_eventQueueCapacity(eventQueueCapacity)
+    {
+    }
+
     AssetStatusTracker::~AssetStatusTracker()
     {
         AzFramework::AssetSystemInfoBus::Handler::BusDisconnect();
     }
 
+    AZ::u64 AssetStatusTracker::HashAssetPath(AZStd::string_view assetPath)
+    {
+        // FNV-1a
+        constexpr AZ::u64 FnvOffsetBasis = 0xcbf29ce484222325ull;
+        constexpr AZ::u64 FnvPrime = 0x100000001b3ull;
+
+        AZ::u64 hash = FnvOffsetBasis;
+        bool previousWasSeparator = false;
+        for (char c : assetPath)
+        {
+            const bool isSeparator = c == '/' || c == '\\';
+            if (isSeparator && previousWasSeparator)
+            {
+                continue;
+            }
+            previousWasSeparator = isSeparator;
+
+            const char lowerCase = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+            hash ^= static_cast<unsigned char>(isSeparator ? '/' : lowerCase);
+            hash *= FnvPrime;
+        }
+        return hash;
+    }
+
     void AssetStatusTracker::StartTracking()
     {
         if (!m_isTracking)
         {
+            // The queue is only allocated once it is needed, since most runs never track assets
+            if (!m_eventQueue.IsInitialized())
+            {
+                m_eventQueue.Initialize(m_eventQueueCapacity);
+            }
+
             AzFramework::AssetSystemInfoBus::Handler::BusConnect();
         }
 
         m_isTracking = true;
 
-        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
-        m_allAssetStatusData.clear();
+        ClearStatus();
     }
 
     void AssetStatusTracker::StopTracking()
@@ -37,90 +142,215 @@ namespace AtomSampleViewer
 
             AzFramework::AssetSystemInfoBus::Handler::BusDisconnect();
 
-            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
-            m_allAssetStatusData.clear();
+            ClearStatus();
         }
     }
 
+    void AssetStatusTracker::ClearStatus()
+    {
+        // Events from before the reset are dropped
+        AssetEvent event;
+        while (m_eventQueue.TryPop(event))
+        {
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+            m_overflowEvents.clear();
+            m_hasOverflowEvents = false;
+        }
+
+        m_allAssetStatusData.clear();
+        m_expectedAssetPaths.clear();
+        m_incompleteExpectedAssetCount = 0;
+        m_activeJobCount = 0;
+    }
+
     void AssetStatusTracker::ExpectAsset(AZStd::string sourceAssetPath, uint32_t expectedCount)
     {
         AzFramework::StringFunc::Path::Normalize(sourceAssetPath);
         AZStd::to_lower(sourceAssetPath.begin(), sourceAssetPath.end());
 
-        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
-        m_allAssetStatusData[sourceAssetPath].m_expectedCount += expectedCount;
+        // Apply the events that already arrived, so jobs that finished before the expectation count toward it
+        ProcessEvents();
+
+        const AZ::u64 assetPathHash = HashAssetPath(sourceAssetPath);
+        m_expectedAssetPaths.emplace(assetPathHash, AZStd::move(sourceAssetPath));
+
+        AssetStatusEvents& status = m_allAssetStatusData[assetPathHash];
+        const bool wasIncomplete = status.IsIncomplete();
+        status.m_expectedCount += expectedCount;
+        if (!wasIncomplete && status.IsIncomplete())
+        {
+            ++m_incompleteExpectedAssetCount;
+        }
     }
 
-    bool AssetStatusTracker::DidExpectedAssetsFinish() const
+    void AssetStatusTracker::ProcessEvents()
     {
-        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
-
-        for (auto& assetData : m_allAssetStatusData)
+        AssetEvent event;
+        while (m_eventQueue.TryPop(event))
         {
-            const AssetStatusEvents& status = assetData.second;
+            ApplyEvent(event);
+        }
 
-            if (status.m_expectedCount > (status.m_succeeded + status.m_failed))
+        if (m_hasOverflowEvents)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+            for (const AssetEvent& overflowEvent : m_overflowEvents)
             {
-                return false;
+                ApplyEvent(overflowEvent);
             }
+            m_overflowEvents.clear();
+            m_hasOverflowEvents = false;
         }
+    }
 
-        return true;
+    void AssetStatusTracker::ApplyEvent(const AssetEvent& event)
+    {
+        // The counts only depend on how many events of each type arrived, so the order events are applied in doesn't matter
+        AssetStatusEvents& status = m_allAssetStatusData[event.m_assetPathHash];
+        const bool wasIncomplete = status.IsIncomplete();
+        m_activeJobCount -= status.GetActiveJobCount();
+
+        switch (event.m_type)
+        {
+        case EventType::Started:
+            status.m_started++;
+            break;
+        case EventType::Succeeded:
+            status.m_succeeded++;
+            break;
+        case EventType::Failed:
+            status.m_failed++;
+            break;
+        }
+
+        m_activeJobCount += status.GetActiveJobCount();
+        if (wasIncomplete && !status.IsIncomplete())
+        {
+            --m_incompleteExpectedAssetCount;
+        }
+    }
+
+    bool AssetStatusTracker::DidExpectedAssetsFinish() const
+    {
+        return m_incompleteExpectedAssetCount == 0;
     }
-    
+
     AZStd::vector<AZStd::string> AssetStatusTracker::GetIncompleteAssetList() const
     {
         AZStd::vector<AZStd::string> incomplete;
-        
-        for (auto& assetData : m_allAssetStatusData)
-        {
-            const AssetStatusEvents& status = assetData.second;
 
-            if (status.m_expectedCount > (status.m_succeeded + status.m_failed))
+        for (auto& [assetPathHash, assetPath] : m_expectedAssetPaths)
+        {
+            auto statusIter = m_allAssetStatusData.find(assetPathHash);
+            if (statusIter != m_allAssetStatusData.end() && statusIter->second.IsIncomplete())
             {
-                incomplete.push_back(assetData.first);
+                incomplete.push_back(assetPath);
             }
         }
 
         return incomplete;
     }
 
+    uint32_t AssetStatusTracker::GetActiveJobCount() const
+    {
+        return m_activeJobCount;
+    }
 
-    void AssetStatusTracker::AssetCompilationStarted(const AZStd::string& assetPath)
+    void AssetStatusTracker::PushEvent(const AZStd::string& assetPath, EventType type)
     {
-        AZ_TracePrintf("Automation", "AssetCompilationStarted(%s)\n", assetPath.c_str());
+        AssetEvent event;
+        event.m_assetPathHash = HashAssetPath(assetPath);
+        event.m_type = type;
 
-        AZStd::string normalizedAssetPath = assetPath;
-        AzFramework::StringFunc::Path::Normalize(normalizedAssetPath);
-        AZStd::to_lower(normalizedAssetPath.begin(), normalizedAssetPath.end());
+        if (!m_eventQueue.TryPush(event))
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+            m_overflowEvents.push_back(event);
+            m_hasOverflowEvents = true;
+        }
+    }
 
-        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
-        m_allAssetStatusData[normalizedAssetPath].m_started++;
+    void AssetStatusTracker::AssetCompilationStarted(const AZStd::string& assetPath)
+    {
+        PushEvent(assetPath, EventType::Started);
     }
 
     void AssetStatusTracker::AssetCompilationSuccess(const AZStd::string& assetPath)
     {
-        AZ_TracePrintf("Automation", "AssetCompilationSuccess(%s)\n", assetPath.c_str());
-
-        AZStd::string normalizedAssetPath = assetPath;
-        AzFramework::StringFunc::Path::Normalize(normalizedAssetPath);
-        AZStd::to_lower(normalizedAssetPath.begin(), normalizedAssetPath.end());
-
-        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
-        m_allAssetStatusData[normalizedAssetPath].m_succeeded++;
+        PushEvent(assetPath, EventType::Succeeded);
     }
 
     void AssetStatusTracker::AssetCompilationFailed(const AZStd::string& assetPath)
     {
-        AZ_TracePrintf("Automation", "AssetCompilationFailed(%s)\n", assetPath.c_str());
+        PushEvent(assetPath, EventType::Failed);
+    }
 
-        AZStd::string normalizedAssetPath = assetPath;
-        AzFramework::StringFunc::Path::Normalize(normalizedAssetPath);
-        AZStd::to_lower(normalizedAssetPath.begin(), normalizedAssetPath.end());
+    AssetStatusTracker::BenchmarkResult AssetStatusTracker::RunBenchmark(uint32_t eventCount, uint32_t threadCount, size_t eventQueueCapacity)
+    {
+        BenchmarkResult result;
+        result.m_eventCount = eventCount;
+        result.m_threadCount = AZStd::max(1u, threadCount);
+        result.m_eventQueueCapacity = AZStd::max<size_t>(1, eventQueueCapacity);
 
-        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
-        m_allAssetStatusData[normalizedAssetPath].m_failed++;
-    }
+        // Every asset gets a started and a succeeded event, like the jobs of a rebuild. The paths are built before timing.
+        const uint32_t assetCount = (eventCount + 1) / 2;
+        AZStd::vector<AZStd::string> assetPaths;
+        assetPaths.reserve(assetCount);
+        for (uint32_t i = 0; i < assetCount; ++i)
+        {
+            assetPaths.push_back(AZStd::string::format("Materials/Benchmark/Asset%u.material", i));
+        }
+
+        AssetStatusTracker tracker(result.m_eventQueueCapacity);
+        tracker.m_eventQueue.Initialize(result.m_eventQueueCapacity);
 
+        // The threads wait for the start flag, so creating them isn't timed
+        AZStd::atomic_bool start{ false };
+        AZStd::vector<AZStd::thread> threads;
+        threads.reserve(result.m_threadCount);
+        for (uint32_t threadIndex = 0; threadIndex < result.m_threadCount; ++threadIndex)
+        {
+            const uint32_t firstEvent = static_cast<uint32_t>(static_cast<AZ::u64>(eventCount) * threadIndex / result.m_threadCount);
+            const uint32_t endEvent = static_cast<uint32_t>(static_cast<AZ::u64>(eventCount) * (threadIndex + 1) / result.m_threadCount);
+            threads.emplace_back([&tracker, &assetPaths, &start, firstEvent, endEvent]()
+            {
+                while (!start.load(AZStd::memory_order_acquire))
+                {
+                    AZStd::this_thread::yield();
+                }
+
+                for (uint32_t i = firstEvent; i < endEvent; ++i)
+                {
+                    tracker.PushEvent(assetPaths[i / 2], i % 2 == 0 ? EventType::Started : EventType::Succeeded);
+                }
+            });
+        }
+
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+        start.store(true, AZStd::memory_order_release);
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        result.m_pushSeconds = timer.StampAndGetDeltaTimeInSeconds();
+        result.m_overflowEventCount = tracker.m_overflowEvents.size();
+
+        tracker.ProcessEvents();
+        result.m_processSeconds = timer.GetDeltaTimeInSeconds();
+
+        // Check that no event was lost. Only the last asset can have an unfinished job, when eventCount is odd.
+        size_t appliedEventCount = 0;
+        for (const auto& assetStatus : tracker.m_allAssetStatusData)
+        {
+            appliedEventCount += assetStatus.second.m_started + assetStatus.second.m_succeeded + assetStatus.second.m_failed;
+        }
+        result.m_allEventsApplied = appliedEventCount == eventCount && tracker.m_activeJobCount == eventCount % 2;
+
+        return result;
+    }
 
 } // namespace AtomSampleViewer
@@ -9,14 +9,28 @@
 #pragma once
 
 #include <AzFramework/Asset/AssetSystemBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AtomSampleViewer
 {
     //! Utility for tracking status of assets being built by the asset processor so scripts can insert delays
+    //!
+    //! The Asset Processor can send a flood of status events during a rebuild, so the event handlers only hash the asset path and
+    //! push the event to a lock-free queue. ProcessEvents() applies the queued events once per frame, and keeps counts of incomplete
+    //! expected assets and active jobs so DidExpectedAssetsFinish() and GetActiveJobCount() are O(1).
     class AssetStatusTracker final
        : public AzFramework::AssetSystemInfoBus::Handler
     {
     public:
+        //! Enough for the events of a full rebuild to wait a frame in the queue without overflowing
+        static constexpr size_t DefaultEventQueueCapacity = 64 * 1024;
+
+        //! @param eventQueueCapacity number of events the lock-free queue can hold. It is allocated the first time tracking starts.
+        explicit AssetStatusTracker(size_t eventQueueCapacity = DefaultEventQueueCapacity);
         ~AssetStatusTracker();
 
         //! Starts tracking asset status updates from the Asset Processor.
@@ -30,17 +44,85 @@ namespace AtomSampleViewer
         //! @param expectedCount number of completed jobs expected for this asset.
         void ExpectAsset(AZStd::string sourceAssetPath, uint32_t expectedCount = 1);
 
+        //! Applies the status events received since the last call. Call this once per frame before checking the status.
+        void ProcessEvents();
+
         //! Returns whether all of the expected assets have finished.
         bool DidExpectedAssetsFinish() const;
 
         //! Return a list of assets that have not completed expected processing.
         AZStd::vector<AZStd::string> GetIncompleteAssetList() const;
 
+        //! Returns the number of Asset Processor jobs that started since StartTracking() and haven't finished yet.
+        uint32_t GetActiveJobCount() const;
+
         //! Stops tracking asset status updates from the Asset Processor. Clears any asset status information already collected.
         void StopTracking();
 
+        //! Returns the hash used to match asset paths. It ignores case, treats both slashes as separators and ignores repeated separators,
+        //! so it gives the same result for a path and its normalized form.
+        static AZ::u64 HashAssetPath(AZStd::string_view assetPath);
+
+        //! Results of RunBenchmark()
+        struct BenchmarkResult
+        {
+            uint32_t m_eventCount = 0;
+            uint32_t m_threadCount = 0;
+            size_t m_eventQueueCapacity = 0;
+            size_t m_overflowEventCount = 0; //!< Events that didn't fit in the lock-free queue and went to the overflow list
+            double m_pushSeconds = 0.0;      //!< Time for all of the threads to push their events
+            double m_processSeconds = 0.0;   //!< Time for ProcessEvents() to apply all of the events
+            bool m_allEventsApplied = false;
+        };
+
+        //! Pushes eventCount status events from threadCount threads into a new tracker, the way the Asset Processor event handlers do,
+        //! then applies them with ProcessEvents(). The tracker doesn't connect to the asset system, so real events don't interfere.
+        //! Nothing is consumed while the threads push, so an eventQueueCapacity smaller than eventCount exercises the overflow path.
+        static BenchmarkResult RunBenchmark(uint32_t eventCount, uint32_t threadCount, size_t eventQueueCapacity);
+
     private:
 
+        enum class EventType : uint32_t
+        {
+            Started,
+            Succeeded,
+            Failed
+        };
+
+        struct AssetEvent
+        {
+            AZ::u64 m_assetPathHash = 0;
+            EventType m_type = EventType::Started;
+        };
+
+        //! Bounded multi-producer queue of asset events, consumed by ProcessEvents() on the main thread.
+        //! Each slot has a sequence number that tells whether it is ready to be written or read, so producers only contend on the tail index.
+        class EventQueue final
+        {
+        public:
+            //! Allocates the slots. Must be called before any producer pushes an event.
+            void Initialize(size_t capacity);
+            bool IsInitialized() const { return m_capacity > 0; }
+
+            //! Returns false if the queue is full.
+            bool TryPush(const AssetEvent& event);
+
+            //! Only called by the consumer
+            bool TryPop(AssetEvent& event);
+
+        private:
+            struct Slot
+            {
+                AZStd::atomic<size_t> m_sequence;
+                AssetEvent m_event;
+            };
+
+            AZStd::unique_ptr<Slot[]> m_slots;
+            size_t m_capacity = 0;
+            AZStd::atomic<size_t> m_tail{ 0 };
+            size_t m_head = 0;
+        };
+
         // Tracks the number of times various events occur
         struct AssetStatusEvents
         {
@@ -48,6 +130,9 @@ namespace AtomSampleViewer
             uint32_t m_succeeded = 0;
             uint32_t m_failed = 0;
             uint32_t m_expectedCount = 0;
+
+            uint32_t GetActiveJobCount() const;
+            bool IsIncomplete() const { return m_expectedCount > (m_succeeded + m_failed); }
         };
 
         // AssetSystemInfoBus overrides...
@@ -55,9 +140,24 @@ namespace AtomSampleViewer
         void AssetCompilationSuccess(const AZStd::string& assetPath) override;
         void AssetCompilationFailed(const AZStd::string& assetPath) override;
 
+        void PushEvent(const AZStd::string& assetPath, EventType type);
+        void ApplyEvent(const AssetEvent& event);
+        void ClearStatus();
+
         bool m_isTracking = false;
 
-        AZStd::unordered_map<AZStd::string /*asset path*/, AssetStatusEvents> m_allAssetStatusData;
-        mutable AZStd::mutex m_mutex;
+        size_t m_eventQueueCapacity = DefaultEventQueueCapacity;
+        EventQueue m_eventQueue;
+
+        //! Events that didn't fit in m_eventQueue. The queue is sized so this is only used in extreme floods.
+        AZStd::vector<AssetEvent> m_overflowEvents;
+        AZStd::mutex m_overflowMutex;
+        AZStd::atomic_bool m_hasOverflowEvents{ false };
+
+        //! Only accessed by the main thread
+        AZStd::unordered_map<AZ::u64 /*asset path hash*/, AssetStatusEvents> m_allAssetStatusData;
+        AZStd::unordered_map<AZ::u64 /*asset path hash*/, AZStd::string> m_expectedAssetPaths;
+        uint32_t m_incompleteExpectedAssetCount = 0;
+        uint32_t m_activeJobCount = 0;
     };
 } // namespace AtomSampleViewer
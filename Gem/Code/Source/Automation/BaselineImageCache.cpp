@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/BaselineImageCache.h>
+#include <Atom/Utils/PngFile.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+
+namespace AtomSampleViewer
+{
+    static constexpr size_t BytesPerPixel = 4;
+
+    AZStd::span<const uint8_t> BaselineImageCache::Image::GetPixels() const
+    {
+        return AZStd::span<const uint8_t>(m_storage.data() + sizeof(SidecarHeader), m_storage.size() - sizeof(SidecarHeader));
+    }
+
+    void BaselineImageCache::Configure(size_t memoryBudget, const AZStd::string& sidecarFolder)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        m_memoryBudget = memoryBudget;
+        m_sidecarFolder = sidecarFolder;
+
+        if (!m_sidecarFolder.empty() && !AZ::IO::LocalFileIO::GetInstance()->CreatePath(m_sidecarFolder.c_str()))
+        {
+            AZ_Warning("BaselineImageCache", false, "Failed to create folder '%s'. Baseline sidecars will not be saved.", m_sidecarFolder.c_str());
+            m_sidecarFolder.clear();
+        }
+
+        EvictToBudget();
+    }
+
+    AZ::u64 BaselineImageCache::HashBytes(AZStd::span<const uint8_t> bytes)
+    {
+        // 64-bit multiply-rotate hash over 8-byte words, with the murmur3 finalizer.
+        static constexpr AZ::u64 Multiplier1 = 0x87c37b91114253d5ull;
+        static constexpr AZ::u64 Multiplier2 = 0x4cf5ad432745937full;
+
+        auto rotateLeft = [](AZ::u64 value, int shift) { return (value << shift) | (value >> (64 - shift)); };
+
+        AZ::u64 hash = bytes.size();
+        size_t i = 0;
+        for (; i + sizeof(AZ::u64) <= bytes.size(); i += sizeof(AZ::u64))
+        {
+            AZ::u64 word;
+            memcpy(&word, bytes.data() + i, sizeof(word));
+            hash ^= rotateLeft(word * Multiplier1, 31) * Multiplier2;
+            hash = rotateLeft(hash, 27) * 5 + 0x52dce729;
+        }
+
+        AZ::u64 tail = 0;
+        memcpy(&tail, bytes.data() + i, bytes.size() - i);
+        hash ^= rotateLeft(tail * Multiplier1, 31) * Multiplier2;
+
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    AZStd::shared_ptr<const BaselineImageCache::Image> BaselineImageCache::LoadImage(AZStd::span<const uint8_t> fileContents, LoadResult& result)
+    {
+        using namespace AZ::Utils;
+
+        PngFile png = PngFile::LoadFromBuffer(fileContents);
+        if (!png.IsValid())
+        {
+            result = LoadResult::FileNotLoaded;
+            return nullptr;
+        }
+
+        if (png.GetBufferFormat() != PngFile::Format::RGBA)
+        {
+            result = LoadResult::WrongFormat;
+            return nullptr;
+        }
+
+        AZStd::shared_ptr<Image> image = AZStd::make_shared<Image>();
+        image->m_width = png.GetWidth();
+        image->m_height = png.GetHeight();
+        image->m_fileHash = HashBytes(fileContents);
+
+        SidecarHeader header;
+        header.m_width = image->m_width;
+        header.m_height = image->m_height;
+        header.m_fileHash = image->m_fileHash;
+
+        const AZStd::vector<uint8_t>& pixels = png.GetBuffer();
+        image->m_storage.resize_no_construct(sizeof(SidecarHeader) + pixels.size());
+        memcpy(image->m_storage.data(), &header, sizeof(SidecarHeader));
+        memcpy(image->m_storage.data() + sizeof(SidecarHeader), pixels.data(), pixels.size());
+
+        result = LoadResult::Success;
+        return image;
+    }
+
+    AZStd::string BaselineImageCache::GetSidecarPath(const AZStd::string& filePath) const
+    {
+        AZStd::string fileName;
+        AzFramework::StringFunc::Path::GetFileName(filePath.c_str(), fileName);
+
+        // The path hash keeps baselines with the same file name in different folders apart
+        const AZ::u64 pathHash = HashBytes(AZStd::span<const uint8_t>(reinterpret_cast<const uint8_t*>(filePath.data()), filePath.size()));
+
+        AZStd::string sidecarPath;
+        AzFramework::StringFunc::Path::Join(
+            m_sidecarFolder.c_str(), AZStd::string::format("%s_%016llx.rgba", fileName.c_str(), static_cast<unsigned long long>(pathHash)).c_str(), sidecarPath);
+        return sidecarPath;
+    }
+
+    AZStd::shared_ptr<const BaselineImageCache::Image> BaselineImageCache::LoadSidecar(const AZStd::string& sidecarPath, AZ::u64 fileHash) const
+    {
+        if (!AZ::IO::LocalFileIO::GetInstance()->Exists(sidecarPath.c_str()))
+        {
+            return nullptr;
+        }
+
+        auto readOutcome = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(sidecarPath);
+        if (!readOutcome.IsSuccess() || readOutcome.GetValue().size() < sizeof(SidecarHeader))
+        {
+            return nullptr;
+        }
+
+        AZStd::shared_ptr<Image> image = AZStd::make_shared<Image>();
+        image->m_storage = readOutcome.TakeValue();
+
+        SidecarHeader header;
+        memcpy(&header, image->m_storage.data(), sizeof(SidecarHeader));
+
+        const size_t expectedSize = sizeof(SidecarHeader) + size_t(header.m_width) * header.m_height * BytesPerPixel;
+        if (header.m_magic != SidecarHeader::ExpectedMagic ||
+            header.m_version != SidecarHeader::ExpectedVersion ||
+            header.m_fileHash != fileHash ||
+            image->m_storage.size() != expectedSize)
+        {
+            // Stale or from a different version, it will be overwritten with the newly decoded image
+            return nullptr;
+        }
+
+        image->m_width = header.m_width;
+        image->m_height = header.m_height;
+        image->m_fileHash = header.m_fileHash;
+        return image;
+    }
+
+    AZStd::shared_ptr<const BaselineImageCache::Image> BaselineImageCache::GetImage(const AZStd::string& filePath, LoadResult& result)
+    {
+        auto io = AZ::IO::LocalFileIO::GetInstance();
+
+        AZ::u64 fileSize = 0;
+        if (!io->Exists(filePath.c_str()) || !io->Size(filePath.c_str(), fileSize))
+        {
+            result = LoadResult::FileNotFound;
+            return nullptr;
+        }
+        const AZ::u64 modificationTime = io->ModificationTime(filePath.c_str());
+
+        AZStd::string sidecarFolder;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            auto iter = m_entries.find(filePath);
+            if (iter != m_entries.end() && iter->second.m_modificationTime == modificationTime && iter->second.m_fileSize == fileSize)
+            {
+                m_lru.splice(m_lru.begin(), m_lru, iter->second.m_lruPosition);
+                ++m_statistics.m_hits;
+                result = LoadResult::Success;
+                return iter->second.m_image;
+            }
+
+            sidecarFolder = m_sidecarFolder;
+        }
+
+        // Loading happens without the lock so other jobs can use the cache meanwhile. If two jobs load the same file
+        // at the same time, both produce the same image and the last one is kept.
+        auto readOutcome = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(filePath);
+        if (!readOutcome.IsSuccess())
+        {
+            result = LoadResult::FileNotLoaded;
+            return nullptr;
+        }
+        const AZStd::vector<uint8_t>& fileContents = readOutcome.GetValue();
+        const AZ::u64 fileHash = HashBytes(fileContents);
+
+        AZStd::shared_ptr<const Image> image;
+        bool loadedFromSidecar = false;
+        AZStd::string sidecarPath;
+        if (!sidecarFolder.empty())
+        {
+            sidecarPath = GetSidecarPath(filePath);
+            image = LoadSidecar(sidecarPath, fileHash);
+            loadedFromSidecar = image != nullptr;
+        }
+
+        if (!image)
+        {
+            image = LoadImage(fileContents, result);
+            if (!image)
+            {
+                return nullptr;
+            }
+
+            if (!sidecarPath.empty())
+            {
+                auto writeOutcome = AZ::Utils::WriteFile(
+                    AZStd::string_view(reinterpret_cast<const char*>(image->m_storage.data()), image->m_storage.size()), sidecarPath);
+                AZ_Warning("BaselineImageCache", writeOutcome.IsSuccess(), "Failed to write baseline sidecar '%s'.", sidecarPath.c_str());
+            }
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        if (loadedFromSidecar)
+        {
+            ++m_statistics.m_sidecarLoads;
+        }
+        else
+        {
+            ++m_statistics.m_decodes;
+        }
+
+        Entry entry;
+        entry.m_modificationTime = modificationTime;
+        entry.m_fileSize = fileSize;
+        entry.m_image = image;
+        Insert(filePath, AZStd::move(entry));
+
+        result = LoadResult::Success;
+        return image;
+    }
+
+    void BaselineImageCache::Insert(const AZStd::string& filePath, Entry&& entry)
+    {
+        auto iter = m_entries.find(filePath);
+        if (iter != m_entries.end())
+        {
+            m_statistics.m_memoryUsed -= iter->second.m_image->m_storage.size();
+            m_lru.erase(iter->second.m_lruPosition);
+            m_entries.erase(iter);
+        }
+
+        m_lru.push_front(filePath);
+        entry.m_lruPosition = m_lru.begin();
+        m_statistics.m_memoryUsed += entry.m_image->m_storage.size();
+        m_entries.emplace(filePath, AZStd::move(entry));
+
+        EvictToBudget();
+    }
+
+    void BaselineImageCache::EvictToBudget()
+    {
+        // Always keep the most recently used image, even if it alone exceeds the budget
+        while (m_statistics.m_memoryUsed > m_memoryBudget && m_lru.size() > 1)
+        {
+            auto iter = m_entries.find(m_lru.back());
+            m_statistics.m_memoryUsed -= iter->second.m_image->m_storage.size();
+            m_entries.erase(iter);
+            m_lru.pop_back();
+        }
+    }
+
+    void BaselineImageCache::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_entries.clear();
+        m_lru.clear();
+        m_statistics.m_memoryUsed = 0;
+    }
+
+    BaselineImageCache::Statistics BaselineImageCache::GetStatistics() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_statistics;
+    }
+
+} // namespace AtomSampleViewer
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Keeps decoded screenshot baseline images in memory so repeated comparisons against the same baseline don't
+    //! re-read and re-decode the PNG. Entries are validated against the file's modification time and size, and
+    //! the least recently used images are evicted when the decoded data exceeds the memory budget.
+    //! Decoded images can also be persisted as raw sidecar files, which load without PNG decoding on the next run.
+    //! All functions are thread safe, so the cache can be used from comparison jobs.
+    class BaselineImageCache
+    {
+    public:
+        enum class LoadResult
+        {
+            Success,
+            FileNotFound,
+            FileNotLoaded,
+            WrongFormat
+        };
+
+        //! A decoded R8G8B8A8 image. The pixels are stored after a SidecarHeader so the storage can be written out as a sidecar file as-is.
+        struct Image
+        {
+            uint32_t m_width = 0;
+            uint32_t m_height = 0;
+            AZ::u64 m_fileHash = 0; //!< Hash of the encoded file contents, used to detect identical files without decoding them
+            AZStd::vector<uint8_t> m_storage;
+
+            AZStd::span<const uint8_t> GetPixels() const;
+        };
+
+        //! Layout of the start of a sidecar file, followed by the pixel data.
+        struct SidecarHeader
+        {
+            static constexpr uint32_t ExpectedMagic = 0x42565341; // "ASVB"
+            static constexpr uint32_t ExpectedVersion = 1;
+
+            uint32_t m_magic = ExpectedMagic;
+            uint32_t m_version = ExpectedVersion;
+            uint32_t m_width = 0;
+            uint32_t m_height = 0;
+            AZ::u64 m_fileHash = 0;
+            AZ::u64 m_reserved = 0;
+        };
+
+        struct Statistics
+        {
+            AZ::u64 m_hits = 0;          //!< Requests that were served from memory
+            AZ::u64 m_sidecarLoads = 0;  //!< Requests that were served from a sidecar file
+            AZ::u64 m_decodes = 0;       //!< Requests that decoded the PNG
+            size_t m_memoryUsed = 0;
+        };
+
+        static constexpr size_t DefaultMemoryBudget = 1024ull * 1024 * 1024;
+
+        //! @param memoryBudget the max number of bytes of decoded images to keep in memory
+        //! @param sidecarFolder folder for persisted sidecar files; empty disables persistence
+        void Configure(size_t memoryBudget, const AZStd::string& sidecarFolder);
+
+        //! Returns the decoded image for the file, loading it if it isn't cached or has changed on disk.
+        //! Returns null and sets result if the image can't be loaded.
+        AZStd::shared_ptr<const Image> GetImage(const AZStd::string& filePath, LoadResult& result);
+
+        //! Decodes an image without caching it.
+        //! @param fileContents the encoded file, which the caller has already read to hash it. The file isn't read again,
+        //!        so the decoded image always matches the hash.
+        static AZStd::shared_ptr<const Image> LoadImage(AZStd::span<const uint8_t> fileContents, LoadResult& result);
+
+        //! Hashes file contents for detecting identical files.
+        static AZ::u64 HashBytes(AZStd::span<const uint8_t> bytes);
+
+        void Clear();
+
+        Statistics GetStatistics() const;
+
+    private:
+        struct Entry
+        {
+            AZ::u64 m_modificationTime = 0;
+            AZ::u64 m_fileSize = 0;
+            AZStd::shared_ptr<const Image> m_image;
+            AZStd::list<AZStd::string>::iterator m_lruPosition;
+        };
+
+        AZStd::string GetSidecarPath(const AZStd::string& filePath) const;
+        AZStd::shared_ptr<const Image> LoadSidecar(const AZStd::string& sidecarPath, AZ::u64 fileHash) const;
+
+        // Must be called with m_mutex locked
+        void Insert(const AZStd::string& filePath, Entry&& entry);
+        void EvictToBudget();
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZStd::string, Entry> m_entries;
+        AZStd::list<AZStd::string> m_lru; //!< Most recently used paths are at the front
+        size_t m_memoryBudget = DefaultMemoryBudget;
+        AZStd::string m_sidecarFolder;
+        Statistics m_statistics;
+    };
+
+} // namespace AtomSampleViewer
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/FrameTimingRecorder.h>
+#include <Atom/RHI/Limits.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RPI.Public/Pass/ParentPass.h>
+#include <Atom/RPI.Public/Pass/PassSystemInterface.h>
+#include <AzCore/Utils/Utils.h>
+
+namespace AtomSampleViewer
+{
+    namespace
+    {
+        void CollectPasses(AZ::RPI::Pass* pass, AZStd::vector<AZ::RPI::Ptr<AZ::RPI::Pass>>& passes)
+        {
+            passes.emplace_back(pass);
+            if (AZ::RPI::ParentPass* parent = pass->AsParent())
+            {
+                for (const AZ::RPI::Ptr<AZ::RPI::Pass>& child : parent->GetChildren())
+                {
+                    CollectPasses(child.get(), passes);
+                }
+            }
+        }
+
+        void WriteRecordingFile(const AZStd::string& outputFilePath, const AZStd::string& contents)
+        {
+            auto writeOutcome = AZ::Utils::WriteFile(contents, outputFilePath);
+            AZ_Error("FrameTimingRecorder", writeOutcome.IsSuccess(), "Failed to write '%s'.", outputFilePath.c_str());
+        }
+    }
+
+    FrameTimingRecorder::~FrameTimingRecorder()
+    {
+        SetTimestampQueriesEnabled(false);
+    }
+
+    void FrameTimingRecorder::StartCpuFrameTimes(uint32_t frameCount, const AZStd::string& outputFilePath)
+    {
+        if (!IsRecording())
+        {
+            m_framesSinceStart = 0;
+        }
+
+        CpuFrameTimeRecording& recording = m_cpuFrameTimeRecordings.emplace_back();
+        recording.m_outputFilePath = outputFilePath;
+        recording.m_frameCount = frameCount;
+        recording.m_frameTimesMs.resize(frameCount, 0.0);
+    }
+
+    void FrameTimingRecorder::StartPassTimestamps(uint32_t frameCount, const AZStd::string& outputFilePath)
+    {
+        AZ::RPI::PassSystemInterface* passSystem = AZ::RPI::PassSystemInterface::Get();
+        if (!passSystem || !passSystem->GetRootPass())
+        {
+            AZ_Error("FrameTimingRecorder", false, "Can't record pass timestamps without a pass system.");
+            return;
+        }
+
+        if (!IsRecording())
+        {
+            m_framesSinceStart = 0;
+        }
+
+        PassTimestampRecording& recording = m_passTimestampRecordings.emplace_back();
+        recording.m_outputFilePath = outputFilePath;
+        recording.m_frameCount = frameCount;
+        recording.m_warmupFrames = AZ::RHI::Limits::Device::FrameCountMax;
+
+        CollectPasses(passSystem->GetRootPass().get(), recording.m_passes);
+        recording.m_passNames.reserve(recording.m_passes.size());
+        for (const AZ::RPI::Ptr<AZ::RPI::Pass>& pass : recording.m_passes)
+        {
+            recording.m_passNames.emplace_back(pass->GetPathName().GetStringView());
+        }
+        recording.m_durationsNs.resize(recording.m_passes.size() * frameCount, 0);
+
+        SetTimestampQueriesEnabled(true);
+    }
+
+    void FrameTimingRecorder::StartSweep(const AZStd::string& parameterName, const AZStd::string& outputFilePath)
+    {
+        if (m_sweep)
+        {
+            AZ_Warning("FrameTimingRecorder", false, "A sweep of '%s' was still in progress and is written out now.", m_sweep->m_parameterName.c_str());
+            EndSweep();
+        }
+
+        m_sweep = AZStd::make_unique<Sweep>();
+        m_sweep->m_parameterName = parameterName;
+        m_sweep->m_outputFilePath = outputFilePath;
+    }
+
+    void FrameTimingRecorder::StartSweepStep(float parameterValue, uint32_t frameCount)
+    {
+        if (!m_sweep)
+        {
+            AZ_Error("FrameTimingRecorder", false, "StartSweepStep() was called without starting a sweep.");
+            return;
+        }
+
+        AZ_Assert(!IsRecordingSweepStep(), "The previous sweep step is still being recorded.");
+
+        if (!IsRecording())
+        {
+            m_framesSinceStart = 0;
+        }
+
+        m_sweep->m_stepFrameTimes.Reset();
+        m_sweep->m_stepParameterValue = parameterValue;
+        m_sweep->m_stepFrameCount = frameCount;
+    }
+
+    void FrameTimingRecorder::EndSweepStep()
+    {
+        const FrameTimeHistogram& frameTimes = m_sweep->m_stepFrameTimes;
+        if (frameTimes.GetCount() > 0)
+        {
+            SweepStep& step = m_sweep->m_steps.emplace_back();
+            step.m_parameterValue = m_sweep->m_stepParameterValue;
+            step.m_frameCount = frameTimes.GetCount();
+            step.m_averageMs = frameTimes.GetMean();
+            step.m_stdDevMs = frameTimes.GetStandardDeviation();
+            step.m_minMs = frameTimes.GetMin();
+            step.m_50pMs = frameTimes.GetQuantile(0.5);
+            step.m_90pMs = frameTimes.GetQuantile(0.9);
+            step.m_99pMs = frameTimes.GetQuantile(0.99);
+            step.m_maxMs = frameTimes.GetMax();
+        }
+
+        m_sweep->m_stepFrameCount = 0;
+    }
+
+    void FrameTimingRecorder::EndSweep()
+    {
+        if (!m_sweep)
+        {
+            return;
+        }
+
+        if (IsRecordingSweepStep())
+        {
+            EndSweepStep();
+        }
+
+        WriteSweep(*m_sweep);
+        m_sweep.reset();
+    }
+
+    void FrameTimingRecorder::Tick()
+    {
+        if (!IsRecording())
+        {
+            return;
+        }
+
+        ++m_framesSinceStart;
+
+        if (!m_cpuFrameTimeRecordings.empty() || IsRecordingSweepStep())
+        {
+            const double frameTimeMs = AZ::RHI::RHISystemInterface::Get()->GetCpuFrameTime();
+            for (CpuFrameTimeRecording& recording : m_cpuFrameTimeRecordings)
+            {
+                recording.m_frameTimesMs[recording.m_recordedFrames++] = frameTimeMs;
+            }
+
+            if (IsRecordingSweepStep())
+            {
+                m_sweep->m_stepFrameTimes.PushValue(static_cast<float>(frameTimeMs));
+                if (m_sweep->m_stepFrameTimes.GetCount() == m_sweep->m_stepFrameCount)
+                {
+                    EndSweepStep();
+                }
+            }
+        }
+
+        for (PassTimestampRecording& recording : m_passTimestampRecordings)
+        {
+            if (recording.m_warmupFrames > 0)
+            {
+                --recording.m_warmupFrames;
+                continue;
+            }
+
+            const size_t frame = recording.m_recordedFrames++;
+            for (size_t passIndex = 0; passIndex < recording.m_passes.size(); ++passIndex)
+            {
+                recording.m_durationsNs[passIndex * recording.m_frameCount + frame] =
+                    recording.m_passes[passIndex]->GetLatestTimestampResult().GetDurationInNanoseconds();
+            }
+        }
+
+        // Write out the recordings that are complete
+        for (auto iter = m_cpuFrameTimeRecordings.begin(); iter != m_cpuFrameTimeRecordings.end();)
+        {
+            if (iter->m_recordedFrames == iter->m_frameCount)
+            {
+                WriteCpuFrameTimes(*iter);
+                iter = m_cpuFrameTimeRecordings.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        for (auto iter = m_passTimestampRecordings.begin(); iter != m_passTimestampRecordings.end();)
+        {
+            if (iter->m_recordedFrames == iter->m_frameCount)
+            {
+                WritePassTimestamps(*iter);
+                iter = m_passTimestampRecordings.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        if (m_passTimestampRecordings.empty())
+        {
+            SetTimestampQueriesEnabled(false);
+        }
+    }
+
+    bool FrameTimingRecorder::IsRecording() const
+    {
+        return !m_cpuFrameTimeRecordings.empty() || !m_passTimestampRecordings.empty() || IsRecordingSweepStep();
+    }
+
+    bool FrameTimingRecorder::IsRecordingFromPreviousFrame() const
+    {
+        return IsRecording() && m_framesSinceStart > 0;
+    }
+
+    void FrameTimingRecorder::FlushAll()
+    {
+        for (CpuFrameTimeRecording& recording : m_cpuFrameTimeRecordings)
+        {
+            recording.m_frameCount = recording.m_recordedFrames;
+            WriteCpuFrameTimes(recording);
+        }
+        m_cpuFrameTimeRecordings.clear();
+
+        for (PassTimestampRecording& recording : m_passTimestampRecordings)
+        {
+            // The columns are laid out for the full frame count, so compact them to the recorded frames
+            for (size_t passIndex = 0; passIndex < recording.m_passes.size(); ++passIndex)
+            {
+                memmove(
+                    recording.m_durationsNs.data() + passIndex * recording.m_recordedFrames,
+                    recording.m_durationsNs.data() + passIndex * recording.m_frameCount,
+                    recording.m_recordedFrames * sizeof(AZ::u64));
+            }
+            recording.m_frameCount = recording.m_recordedFrames;
+            WritePassTimestamps(recording);
+        }
+        m_passTimestampRecordings.clear();
+
+        EndSweep();
+
+        SetTimestampQueriesEnabled(false);
+    }
+
+    void FrameTimingRecorder::WriteSweep(const Sweep& sweep)
+    {
+        // The marginal cost is the slope of the average frame time from the previous step, which shows where the curve bends
+        AZStd::string contents;
+        contents.reserve(128 + sweep.m_steps.size() * 128);
+        contents += AZStd::string::format("\"%s\",frameCount,averageMs,stdDevMs,minMs,50pMs,90pMs,99pMs,maxMs,marginalMsPerUnit\n", sweep.m_parameterName.c_str());
+        for (size_t i = 0; i < sweep.m_steps.size(); ++i)
+        {
+            const SweepStep& step = sweep.m_steps[i];
+            contents += AZStd::string::format("%g,%llu,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,",
+                step.m_parameterValue, static_cast<unsigned long long>(step.m_frameCount),
+                step.m_averageMs, step.m_stdDevMs, step.m_minMs, step.m_50pMs, step.m_90pMs, step.m_99pMs, step.m_maxMs);
+
+            if (i > 0 && step.m_parameterValue != sweep.m_steps[i - 1].m_parameterValue)
+            {
+                const SweepStep& previous = sweep.m_steps[i - 1];
+                contents += AZStd::string::format("%.6g", (step.m_averageMs - previous.m_averageMs) / (step.m_parameterValue - previous.m_parameterValue));
+            }
+            contents += "\n";
+        }
+
+        WriteRecordingFile(sweep.m_outputFilePath, contents);
+    }
+
+    void FrameTimingRecorder::WriteCpuFrameTimes(const CpuFrameTimeRecording& recording)
+    {
+        AZStd::string contents;
+        contents.reserve(64 + recording.m_frameCount * 16);
+        contents += AZStd::string::format("{\n    \"frameCount\": %u,\n    \"cpuFrameTimesMs\": [", recording.m_frameCount);
+        for (uint32_t frame = 0; frame < recording.m_frameCount; ++frame)
+        {
+            contents += AZStd::string::format(frame == 0 ? "%.6f" : ", %.6f", recording.m_frameTimesMs[frame]);
+        }
+        contents += "]\n}\n";
+
+        WriteRecordingFile(recording.m_outputFilePath, contents);
+    }
+
+    void FrameTimingRecorder::WritePassTimestamps(const PassTimestampRecording& recording)
+    {
+        AZStd::string contents;
+        contents.reserve(64 + recording.m_passes.size() * (128 + recording.m_frameCount * 10));
+        contents += AZStd::string::format("{\n    \"frameCount\": %u,\n    \"passes\": [", recording.m_frameCount);
+        for (size_t passIndex = 0; passIndex < recording.m_passes.size(); ++passIndex)
+        {
+            contents += AZStd::string::format("%s\n        { \"name\": \"%s\", \"durationsNs\": [", passIndex == 0 ? "" : ",", recording.m_passNames[passIndex].c_str());
+
+            const AZ::u64* column = recording.m_durationsNs.data() + passIndex * recording.m_frameCount;
+            for (uint32_t frame = 0; frame < recording.m_frameCount; ++frame)
+            {
+                contents += AZStd::string::format(frame == 0 ? "%llu" : ", %llu", static_cast<unsigned long long>(column[frame]));
+            }
+            contents += "] }";
+        }
+        contents += "\n    ]\n}\n";
+
+        WriteRecordingFile(recording.m_outputFilePath, contents);
+    }
+
+    void FrameTimingRecorder::SetTimestampQueriesEnabled(bool enabled)
+    {
+        if (m_timestampQueriesEnabled == enabled)
+        {
+            return;
+        }
+
+        if (AZ::RPI::PassSystemInterface* passSystem = AZ::RPI::PassSystemInterface::Get(); passSystem && passSystem->GetRootPass())
+        {
+            passSystem->GetRootPass()->SetTimestampQueryEnabled(enabled);
+        }
+        m_timestampQueriesEnabled = enabled;
+    }
+
+} // namespace AtomSampleViewer
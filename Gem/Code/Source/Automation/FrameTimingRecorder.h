@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Public/Pass/Pass.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+#include <Utils/FrameTimeHistogram.h>
+
+namespace AtomSampleViewer
+{
+    //! Records CPU frame times and pass timestamps over many consecutive frames and writes each recording to a single file.
+    //! This is the batched alternative to capturing one frame at a time through the ProfilingCaptureRequestBus, which
+    //! writes one file per frame and requires pausing the script for every frame.
+    //! All storage is allocated when a recording starts, so recording a frame only copies a few values.
+    class FrameTimingRecorder final
+    {
+    public:
+        ~FrameTimingRecorder();
+
+        //! Records the CPU frame time of the next frameCount frames.
+        void StartCpuFrameTimes(uint32_t frameCount, const AZStd::string& outputFilePath);
+
+        //! Records the GPU timestamp duration of every pass for the next frameCount frames.
+        //! Recording starts after a few warm-up frames because timestamp results are only available some frames after they are requested.
+        void StartPassTimestamps(uint32_t frameCount, const AZStd::string& outputFilePath);
+
+        //! Starts a scalability sweep, which measures frame time statistics for a series of values of one parameter.
+        //! The statistics of every step are written as one row of a CSV file when the sweep ends.
+        void StartSweep(const AZStd::string& parameterName, const AZStd::string& outputFilePath);
+
+        //! Records the CPU frame time statistics of the next frameCount frames as the sweep step for parameterValue.
+        void StartSweepStep(float parameterValue, uint32_t frameCount);
+
+        //! Writes the sweep file.
+        void EndSweep();
+
+        //! Returns true while a sweep step is recording. Scripts must wait for it, so every step records its own parameter value.
+        bool IsRecordingSweepStep() const { return m_sweep && m_sweep->m_stepFrameCount > 0; }
+
+        //! Records the frame that just finished. Recordings that are complete are written to their file.
+        void Tick();
+
+        //! Returns true while any recording is in progress.
+        bool IsRecording() const;
+
+        //! Returns true if a recording has been in progress for at least one frame.
+        //! Scripts can start more recordings in the same frame, so they record the same frames, but must wait once this is true.
+        bool IsRecordingFromPreviousFrame() const;
+
+        //! Stops all recordings, writing out the frames recorded so far.
+        void FlushAll();
+
+    private:
+        struct CpuFrameTimeRecording
+        {
+            AZStd::string m_outputFilePath;
+            uint32_t m_frameCount = 0;
+            uint32_t m_recordedFrames = 0;
+            AZStd::vector<double> m_frameTimesMs;
+        };
+
+        //! Stored by column: the durations of one pass for all frames are contiguous.
+        struct PassTimestampRecording
+        {
+            AZStd::string m_outputFilePath;
+            uint32_t m_frameCount = 0;
+            uint32_t m_warmupFrames = 0;
+            uint32_t m_recordedFrames = 0;
+            AZStd::vector<AZ::RPI::Ptr<AZ::RPI::Pass>> m_passes;
+            AZStd::vector<AZStd::string> m_passNames;
+            AZStd::vector<AZ::u64> m_durationsNs;
+        };
+
+        //! Frame time statistics for one parameter value of a sweep
+        struct SweepStep
+        {
+            float m_parameterValue = 0.0f;
+            AZ::u64 m_frameCount = 0;
+            double m_averageMs = 0.0;
+            double m_stdDevMs = 0.0;
+            double m_minMs = 0.0;
+            double m_50pMs = 0.0;
+            double m_90pMs = 0.0;
+            double m_99pMs = 0.0;
+            double m_maxMs = 0.0;
+        };
+
+        struct Sweep
+        {
+            AZStd::string m_parameterName;
+            AZStd::string m_outputFilePath;
+            AZStd::vector<SweepStep> m_steps;
+
+            //! The step being recorded
+            FrameTimeHistogram m_stepFrameTimes;
+            float m_stepParameterValue = 0.0f;
+            uint32_t m_stepFrameCount = 0;
+        };
+
+        void EndSweepStep();
+
+        static void WriteSweep(const Sweep& sweep);
+        static void WriteCpuFrameTimes(const CpuFrameTimeRecording& recording);
+        static void WritePassTimestamps(const PassTimestampRecording& recording);
+
+        void SetTimestampQueriesEnabled(bool enabled);
+
+        AZStd::vector<CpuFrameTimeRecording> m_cpuFrameTimeRecordings;
+        AZStd::vector<PassTimestampRecording> m_passTimestampRecordings;
+        AZStd::unique_ptr<Sweep> m_sweep;  //!< Allocated while a sweep is in progress, the histogram is large
+        uint32_t m_framesSinceStart = 0;
+        bool m_timestampQueriesEnabled = false;
+    };
+
+} // namespace AtomSampleViewer
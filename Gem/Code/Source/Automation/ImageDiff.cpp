@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/ImageDiff.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/math.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <emmintrin.h>
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace AtomSampleViewer
+{
+    namespace ImageDiff
+    {
+        static constexpr size_t BytesPerPixel = 4;
+
+        //! Images with more pixels than this are split into tiles of this size that are processed in parallel.
+        static constexpr size_t PixelsPerTile = 64 * 1024;
+
+        //! Packed R8G8B8A8 values of the output pixels.
+        static constexpr uint32_t DefaultPixel = 0xFF000000u | (DefaultPixelValue << 16) | (DefaultPixelValue << 8) | DefaultPixelValue;
+        static constexpr uint32_t OpaqueAlpha = 0xFF000000u;
+
+        static uint8_t MaxChannelDifference(const uint8_t* pixelA, const uint8_t* pixelB)
+        {
+            uint8_t maxDiff = 0;
+            for (size_t channel = 0; channel < BytesPerPixel; ++channel)
+            {
+                const uint8_t a = pixelA[channel];
+                const uint8_t b = pixelB[channel];
+                maxDiff = AZStd::max<uint8_t>(maxDiff, a > b ? a - b : b - a);
+            }
+            return maxDiff;
+        }
+
+        static void GenerateImageDiffScalar(const uint8_t* imageA, const uint8_t* imageB, uint8_t* output, size_t pixelCount)
+        {
+            for (size_t i = 0; i < pixelCount * BytesPerPixel; i += BytesPerPixel)
+            {
+                const uint8_t maxDiff = MaxChannelDifference(imageA + i, imageB + i);
+                const uint32_t pixel = maxDiff >= MinChannelDifference ? (OpaqueAlpha | maxDiff) : DefaultPixel;
+                memcpy(output + i, &pixel, sizeof(pixel));
+            }
+        }
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        //! Returns the max channel difference of each of 4 pixels, as 32-bit integers.
+        static __m128i MaxChannelDifference4(__m128i a, __m128i b)
+        {
+            const __m128i absDiff = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+            __m128i maxDiff = _mm_max_epu8(absDiff, _mm_srli_epi32(absDiff, 16));
+            maxDiff = _mm_max_epu8(maxDiff, _mm_srli_epi32(maxDiff, 8));
+            return _mm_and_si128(maxDiff, _mm_set1_epi32(0xFF));
+        }
+
+        //! Computes the output for 4 pixels. The max channel difference goes in the low (red) byte of each pixel.
+        static __m128i DiffFourPixels(__m128i a, __m128i b, __m128i threshold, __m128i defaultPixel, __m128i opaqueAlpha)
+        {
+            const __m128i maxDiff = MaxChannelDifference4(a, b);
+            const __m128i isDifferent = _mm_cmpgt_epi32(maxDiff, threshold);
+            const __m128i diffPixel = _mm_or_si128(maxDiff, opaqueAlpha);
+            return _mm_or_si128(_mm_and_si128(isDifferent, diffPixel), _mm_andnot_si128(isDifferent, defaultPixel));
+        }
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+        static uint32x4_t MaxChannelDifference4(uint8x16_t a, uint8x16_t b)
+        {
+            const uint8x16_t absDiff = vabdq_u8(a, b);
+            uint8x16_t maxDiff = vmaxq_u8(absDiff, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(absDiff), 16)));
+            maxDiff = vmaxq_u8(maxDiff, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(maxDiff), 8)));
+            return vandq_u32(vreinterpretq_u32_u8(maxDiff), vdupq_n_u32(0xFF));
+        }
+
+        static uint32x4_t DiffFourPixels(uint8x16_t a, uint8x16_t b, uint32x4_t threshold, uint32x4_t defaultPixel, uint32x4_t opaqueAlpha)
+        {
+            const uint32x4_t maxDiff32 = MaxChannelDifference4(a, b);
+            const uint32x4_t isDifferent = vcgeq_u32(maxDiff32, threshold);
+            return vbslq_u32(isDifferent, vorrq_u32(maxDiff32, opaqueAlpha), defaultPixel);
+        }
+#endif
+
+        void GenerateImageDiffTile(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, AZStd::span<uint8_t> output)
+        {
+            const size_t pixelCount = output.size() / BytesPerPixel;
+            const uint8_t* a = imageA.data();
+            const uint8_t* b = imageB.data();
+            uint8_t* out = output.data();
+            size_t pixel = 0;
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            const __m128i threshold = _mm_set1_epi32(MinChannelDifference - 1);
+            const __m128i defaultPixel = _mm_set1_epi32(static_cast<int>(DefaultPixel));
+            const __m128i opaqueAlpha = _mm_set1_epi32(static_cast<int>(OpaqueAlpha));
+
+            // 16 pixels per iteration, as four independent 128-bit lanes of 4 pixels
+            for (; pixel + 16 <= pixelCount; pixel += 16)
+            {
+                const size_t offset = pixel * BytesPerPixel;
+                for (size_t lane = 0; lane < 4; ++lane)
+                {
+                    const size_t laneOffset = offset + lane * 16;
+                    const __m128i pixelsA = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + laneOffset));
+                    const __m128i pixelsB = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + laneOffset));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + laneOffset), DiffFourPixels(pixelsA, pixelsB, threshold, defaultPixel, opaqueAlpha));
+                }
+            }
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+            const uint32x4_t threshold = vdupq_n_u32(MinChannelDifference);
+            const uint32x4_t defaultPixel = vdupq_n_u32(DefaultPixel);
+            const uint32x4_t opaqueAlpha = vdupq_n_u32(OpaqueAlpha);
+
+            for (; pixel + 16 <= pixelCount; pixel += 16)
+            {
+                const size_t offset = pixel * BytesPerPixel;
+                for (size_t lane = 0; lane < 4; ++lane)
+                {
+                    const size_t laneOffset = offset + lane * 16;
+                    const uint32x4_t result = DiffFourPixels(vld1q_u8(a + laneOffset), vld1q_u8(b + laneOffset), threshold, defaultPixel, opaqueAlpha);
+                    vst1q_u8(out + laneOffset, vreinterpretq_u8_u32(result));
+                }
+            }
+#endif
+
+            const size_t offset = pixel * BytesPerPixel;
+            GenerateImageDiffScalar(a + offset, b + offset, out + offset, pixelCount - pixel);
+        }
+
+        void GenerateImageDiff(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, AZStd::span<uint8_t> output)
+        {
+            AZ_Assert(imageA.size() == imageB.size() && imageA.size() == output.size(), "Images must be the same size");
+            AZ_Assert(output.size() % BytesPerPixel == 0, "Images must be R8G8B8A8");
+
+            const size_t pixelCount = output.size() / BytesPerPixel;
+            if (pixelCount <= PixelsPerTile)
+            {
+                GenerateImageDiffTile(imageA, imageB, output);
+                return;
+            }
+
+            AZ::JobCompletion completion;
+            for (size_t firstPixel = 0; firstPixel < pixelCount; firstPixel += PixelsPerTile)
+            {
+                const size_t offset = firstPixel * BytesPerPixel;
+                const size_t size = AZStd::min(PixelsPerTile, pixelCount - firstPixel) * BytesPerPixel;
+
+                AZ::Job* job = AZ::CreateJobFunction([imageA, imageB, output, offset, size]()
+                    {
+                        GenerateImageDiffTile(imageA.subspan(offset, size), imageB.subspan(offset, size), output.subspan(offset, size));
+                    }, true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+
+        //! Sums of squared max channel differences, in units of 1/255^2.
+        struct SquaredDiffSums
+        {
+            AZ::u64 m_all = 0;
+            AZ::u64 m_filtered = 0;
+        };
+
+        //! Pixels per SIMD accumulation pass. Each 32-bit lane accumulates 1/4 of these, at most 255^2 each, which must not overflow.
+        static constexpr size_t PixelsPerAccumulation = 16 * 1024;
+
+        //! @param filterThreshold the smallest max channel difference that counts towards the filtered sum
+        static SquaredDiffSums SumSquaredDiffs(const uint8_t* a, const uint8_t* b, size_t pixelCount, uint32_t filterThreshold)
+        {
+            SquaredDiffSums sums;
+            size_t pixel = 0;
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            const __m128i threshold = _mm_set1_epi32(static_cast<int>(filterThreshold) - 1);
+
+            while (pixel + 16 <= pixelCount)
+            {
+                const size_t passEnd = AZStd::min(pixelCount, pixel + PixelsPerAccumulation);
+                __m128i allAccumulator = _mm_setzero_si128();
+                __m128i filteredAccumulator = _mm_setzero_si128();
+
+                for (; pixel + 16 <= passEnd; pixel += 16)
+                {
+                    const size_t offset = pixel * BytesPerPixel;
+                    for (size_t lane = 0; lane < 4; ++lane)
+                    {
+                        const size_t laneOffset = offset + lane * 16;
+                        const __m128i pixelsA = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + laneOffset));
+                        const __m128i pixelsB = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + laneOffset));
+                        const __m128i maxDiff = MaxChannelDifference4(pixelsA, pixelsB);
+
+                        // The high 16 bits of each lane are zero, so this is maxDiff * maxDiff per lane
+                        const __m128i squared = _mm_madd_epi16(maxDiff, maxDiff);
+                        allAccumulator = _mm_add_epi32(allAccumulator, squared);
+                        filteredAccumulator = _mm_add_epi32(filteredAccumulator, _mm_and_si128(_mm_cmpgt_epi32(maxDiff, threshold), squared));
+                    }
+                }
+
+                alignas(16) uint32_t allLanes[4];
+                alignas(16) uint32_t filteredLanes[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(allLanes), allAccumulator);
+                _mm_store_si128(reinterpret_cast<__m128i*>(filteredLanes), filteredAccumulator);
+                for (size_t lane = 0; lane < 4; ++lane)
+                {
+                    sums.m_all += allLanes[lane];
+                    sums.m_filtered += filteredLanes[lane];
+                }
+            }
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+            const uint32x4_t threshold = vdupq_n_u32(filterThreshold);
+
+            while (pixel + 16 <= pixelCount)
+            {
+                const size_t passEnd = AZStd::min(pixelCount, pixel + PixelsPerAccumulation);
+                uint32x4_t allAccumulator = vdupq_n_u32(0);
+                uint32x4_t filteredAccumulator = vdupq_n_u32(0);
+
+                for (; pixel + 16 <= passEnd; pixel += 16)
+                {
+                    const size_t offset = pixel * BytesPerPixel;
+                    for (size_t lane = 0; lane < 4; ++lane)
+                    {
+                        const size_t laneOffset = offset + lane * 16;
+                        const uint32x4_t maxDiff = MaxChannelDifference4(vld1q_u8(a + laneOffset), vld1q_u8(b + laneOffset));
+                        const uint32x4_t squared = vmulq_u32(maxDiff, maxDiff);
+                        allAccumulator = vaddq_u32(allAccumulator, squared);
+                        filteredAccumulator = vaddq_u32(filteredAccumulator, vandq_u32(vcgeq_u32(maxDiff, threshold), squared));
+                    }
+                }
+
+                sums.m_all += vaddvq_u32(allAccumulator);
+                sums.m_filtered += vaddvq_u32(filteredAccumulator);
+            }
+#endif
+
+            for (; pixel < pixelCount; ++pixel)
+            {
+                const uint32_t maxDiff = MaxChannelDifference(a + pixel * BytesPerPixel, b + pixel * BytesPerPixel);
+                const uint32_t squared = maxDiff * maxDiff;
+                sums.m_all += squared;
+                sums.m_filtered += maxDiff >= filterThreshold ? squared : 0;
+            }
+
+            return sums;
+        }
+
+        DiffScores CalcImageDiffRms(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, float minDiffFilter)
+        {
+            AZ_Assert(imageA.size() == imageB.size(), "Images must be the same size");
+            AZ_Assert(imageA.size() % BytesPerPixel == 0, "Images must be R8G8B8A8");
+
+            DiffScores scores;
+            const size_t pixelCount = imageA.size() / BytesPerPixel;
+            if (pixelCount == 0)
+            {
+                return scores;
+            }
+
+            // Find the smallest difference that passes the same float test as CalcImageDiffRms, so the filter matches exactly.
+            uint32_t filterThreshold = 0;
+            while (filterThreshold <= 255 && !(static_cast<float>(filterThreshold) / 255.0f > minDiffFilter))
+            {
+                ++filterThreshold;
+            }
+
+            SquaredDiffSums sums;
+            if (pixelCount <= PixelsPerTile)
+            {
+                sums = SumSquaredDiffs(imageA.data(), imageB.data(), pixelCount, filterThreshold);
+            }
+            else
+            {
+                const size_t tileCount = (pixelCount + PixelsPerTile - 1) / PixelsPerTile;
+                AZStd::vector<SquaredDiffSums> tileSums(tileCount);
+
+                AZ::JobCompletion completion;
+                for (size_t tile = 0; tile < tileCount; ++tile)
+                {
+                    const size_t firstPixel = tile * PixelsPerTile;
+                    const size_t tilePixelCount = AZStd::min(PixelsPerTile, pixelCount - firstPixel);
+                    const uint8_t* a = imageA.data() + firstPixel * BytesPerPixel;
+                    const uint8_t* b = imageB.data() + firstPixel * BytesPerPixel;
+                    SquaredDiffSums* result = &tileSums[tile];
+
+                    AZ::Job* job = AZ::CreateJobFunction([a, b, tilePixelCount, filterThreshold, result]()
+                        {
+                            *result = SumSquaredDiffs(a, b, tilePixelCount, filterThreshold);
+                        }, true);
+                    job->SetDependent(&completion);
+                    job->Start();
+                }
+                completion.StartAndWaitForCompletion();
+
+                for (const SquaredDiffSums& tileSum : tileSums)
+                {
+                    sums.m_all += tileSum.m_all;
+                    sums.m_filtered += tileSum.m_filtered;
+                }
+            }
+
+            const double normalization = 255.0 * 255.0 * static_cast<double>(pixelCount);
+            scores.m_diffScore = static_cast<float>(AZStd::sqrt(static_cast<double>(sums.m_all) / normalization));
+            scores.m_filteredDiffScore = static_cast<float>(AZStd::sqrt(static_cast<double>(sums.m_filtered) / normalization));
+            return scores;
+        }
+
+        AZStd::vector<uint8_t> CreateDiffReportImage(AZStd::span<const uint8_t> baseline, AZStd::span<const uint8_t> screenshot)
+        {
+            const size_t imageSize = baseline.size();
+
+            // The diff is generated directly into its slice of the output
+            AZStd::vector<uint8_t> buffer(imageSize * 3);
+            memcpy(buffer.data(), baseline.data(), imageSize);
+            memcpy(buffer.data() + imageSize, screenshot.data(), imageSize);
+            GenerateImageDiff(baseline, screenshot, AZStd::span<uint8_t>(buffer.data() + imageSize * 2, imageSize));
+            return buffer;
+        }
+
+    } // namespace ImageDiff
+} // namespace AtomSampleViewer
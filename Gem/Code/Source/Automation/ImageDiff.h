@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AtomSampleViewer
+{
+    namespace ImageDiff
+    {
+        //! Value used for the color channels of pixels that have no significant difference.
+        static constexpr uint8_t DefaultPixelValue = 122;
+
+        //! Smallest max-channel difference that is highlighted in a diff image. Matches a 1% difference (maxDiff / 255 > 0.01).
+        static constexpr uint8_t MinChannelDifference = 3;
+
+        //! Writes a heatmap of the differences between two R8G8B8A8 images of the same size.
+        //! Pixels whose max channel difference is at least MinChannelDifference are written as red with that difference as intensity,
+        //! all others are gray. Large images are split into tiles that are processed in parallel on the job system.
+        //! @param imageA, imageB the images to compare
+        //! @param output receives the heatmap; must be the same size as the input images and may be a sub-range of a larger buffer
+        void GenerateImageDiff(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, AZStd::span<uint8_t> output);
+
+        //! Single-threaded version of GenerateImageDiff(), used for each tile.
+        void GenerateImageDiffTile(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, AZStd::span<uint8_t> output);
+
+        //! Root-mean-square of the per-pixel max channel differences, normalized to the 0-1 range.
+        struct DiffScores
+        {
+            float m_diffScore = 0.0f;         //!< Includes every difference
+            float m_filteredDiffScore = 0.0f; //!< Only includes differences above the minDiffFilter, to ignore visually imperceptible changes
+        };
+
+        //! Scores the differences between two R8G8B8A8 images of the same size, using the same metric as AZ::Utils::CalcImageDiffRms.
+        //! Squared differences are accumulated as integers so the result doesn't depend on how the work is split.
+        //! Large images are split into tiles that are processed in parallel on the job system.
+        DiffScores CalcImageDiffRms(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, float minDiffFilter);
+
+        //! Builds the image that is exported for a failed screenshot: the baseline, the screenshot and their diff heatmap stacked vertically.
+        //! The result is an R8G8B8A8 image with the same width as the inputs and three times their height.
+        AZStd::vector<uint8_t> CreateDiffReportImage(AZStd::span<const uint8_t> baseline, AZStd::span<const uint8_t> screenshot);
+
+    } // namespace ImageDiff
+} // namespace AtomSampleViewer
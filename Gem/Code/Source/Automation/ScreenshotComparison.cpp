@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/ScreenshotComparison.h>
+#include <AzCore/Utils/Utils.h>
+
+namespace AtomSampleViewer
+{
+    //! Differences at or below this level are excluded from the filtered diff score.
+    static constexpr float ImperceptibleDiffFilter = 0.01f;
+
+    static ScreenshotComparison::Result ToComparisonResult(BaselineImageCache::LoadResult loadResult)
+    {
+        switch (loadResult)
+        {
+        case BaselineImageCache::LoadResult::FileNotFound:
+            return ScreenshotComparison::Result::FileNotFound;
+        case BaselineImageCache::LoadResult::WrongFormat:
+            return ScreenshotComparison::Result::WrongFormat;
+        default:
+            return ScreenshotComparison::Result::FileNotLoaded;
+        }
+    }
+
+    ScreenshotComparison::ScreenshotComparison(const AZStd::string& screenshotFilePath, BaselineImageCache& baselineImageCache)
+        : m_screenshotFilePath(screenshotFilePath)
+        , m_baselineImageCache(baselineImageCache)
+    {
+        auto readOutcome = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(m_screenshotFilePath);
+        if (readOutcome.IsSuccess())
+        {
+            m_screenshotFile = readOutcome.TakeValue();
+            m_screenshotHash = BaselineImageCache::HashBytes(m_screenshotFile);
+            m_screenshotFileLoaded = true;
+        }
+        else
+        {
+            m_screenshotLoadResult = BaselineImageCache::LoadResult::FileNotLoaded;
+        }
+    }
+
+    AZStd::shared_ptr<const BaselineImageCache::Image> ScreenshotComparison::GetScreenshot()
+    {
+        if (!m_screenshot && m_screenshotLoadResult == BaselineImageCache::LoadResult::Success)
+        {
+            m_screenshot = BaselineImageCache::LoadImage(m_screenshotFile, m_screenshotLoadResult);
+        }
+        return m_screenshot;
+    }
+
+    ScreenshotComparison::Outcome ScreenshotComparison::CompareWithBaseline(const AZStd::string& baselineFilePath)
+    {
+        Outcome outcome;
+
+        if (!m_screenshotFileLoaded)
+        {
+            outcome.m_result = Result::FileNotLoaded;
+            return outcome;
+        }
+
+        BaselineImageCache::LoadResult loadResult;
+        outcome.m_baseline = m_baselineImageCache.GetImage(baselineFilePath, loadResult);
+        if (!outcome.m_baseline)
+        {
+            outcome.m_result = ToComparisonResult(loadResult);
+            return outcome;
+        }
+
+        // Identical files can't have any differences
+        if (outcome.m_baseline->m_fileHash == m_screenshotHash)
+        {
+            outcome.m_result = Result::Compared;
+            return outcome;
+        }
+
+        AZStd::shared_ptr<const BaselineImageCache::Image> screenshot = GetScreenshot();
+        if (!screenshot)
+        {
+            outcome.m_result = ToComparisonResult(m_screenshotLoadResult);
+            return outcome;
+        }
+
+        if (outcome.m_baseline->m_width != screenshot->m_width || outcome.m_baseline->m_height != screenshot->m_height)
+        {
+            outcome.m_result = Result::WrongSize;
+            return outcome;
+        }
+
+        const AZStd::span<const uint8_t> baselinePixels = outcome.m_baseline->GetPixels();
+        const AZStd::span<const uint8_t> screenshotPixels = screenshot->GetPixels();
+
+        // PNG encoding can differ for identical pixels, so compare the pixels directly before scoring them
+        if (memcmp(baselinePixels.data(), screenshotPixels.data(), baselinePixels.size()) != 0)
+        {
+            outcome.m_scores = ImageDiff::CalcImageDiffRms(screenshotPixels, baselinePixels, ImperceptibleDiffFilter);
+        }
+        outcome.m_result = Result::Compared;
+        return outcome;
+    }
+
+    const char* ScreenshotComparison::ToString(Result result)
+    {
+        switch (result)
+        {
+        case Result::Compared:
+            return "Compared";
+        case Result::FileNotFound:
+            return "File not found";
+        case Result::FileNotLoaded:
+            return "File load failed";
+        case Result::WrongFormat:
+            return "Format is not supported";
+        case Result::WrongSize:
+            return "Wrong size";
+        default:
+            return "Unknown";
+        }
+    }
+
+} // namespace AtomSampleViewer
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Automation/BaselineImageCache.h>
+#include <Automation/ImageDiff.h>
+
+namespace AtomSampleViewer
+{
+    //! Compares one captured screenshot against any number of baseline images.
+    //! The screenshot file is read and hashed once. A baseline whose file is byte-identical passes without any pixel work;
+    //! otherwise the screenshot is decoded on first use and shared by all comparisons.
+    //! Used by the ScriptReporter and by the offline AtomSampleViewer.ImageCompare tool.
+    class ScreenshotComparison
+    {
+    public:
+        enum class Result
+        {
+            Compared,       //!< The scores are valid
+            FileNotFound,
+            FileNotLoaded,
+            WrongFormat,
+            WrongSize
+        };
+
+        struct Outcome
+        {
+            Result m_result = Result::FileNotLoaded;
+            ImageDiff::DiffScores m_scores;
+            AZStd::shared_ptr<const BaselineImageCache::Image> m_baseline; //!< The decoded baseline, if it could be loaded
+        };
+
+        ScreenshotComparison(const AZStd::string& screenshotFilePath, BaselineImageCache& baselineImageCache);
+
+        Outcome CompareWithBaseline(const AZStd::string& baselineFilePath);
+
+        //! Returns the decoded screenshot, decoding it if no comparison needed it so far. Returns null if it can't be loaded.
+        AZStd::shared_ptr<const BaselineImageCache::Image> GetScreenshot();
+
+        static const char* ToString(Result result);
+
+    private:
+        AZStd::string m_screenshotFilePath;
+        BaselineImageCache& m_baselineImageCache;
+
+        AZStd::vector<uint8_t> m_screenshotFile;
+        AZ::u64 m_screenshotHash = 0;
+        bool m_screenshotFileLoaded = false;
+
+        AZStd::shared_ptr<const BaselineImageCache::Image> m_screenshot;
+        BaselineImageCache::LoadResult m_screenshotLoadResult = BaselineImageCache::LoadResult::Success;
+    };
+
+} // namespace AtomSampleViewer
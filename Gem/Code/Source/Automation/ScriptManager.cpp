@@ -19,6 +19,9 @@
 #include <Atom/Feature/ImGui/SystemBus.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RHI/Factory.h>
+#include <Atom/RHI/RHISystemInterface.h>
+
+#include <AzCore/Asset/AssetManager.h>
 
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Settings/SettingsRegistryScriptUtils.h>
@@ -28,6 +31,7 @@
 #include <AzCore/Math/MathReflection.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Time/ITime.h>
+#include <AzCore/std/math.h>
 
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/Components/ConsoleBus.h>
@@ -54,6 +58,23 @@ namespace AtomSampleViewer
         return s_instance;
     }
 
+    template<typename OperationT>
+    void ScriptManager::PushScriptOperation(const char* name, OperationT&& operation)
+    {
+        static constexpr AZStd::string_view ScriptFunctionPrefix = "Script_";
+        if (AZStd::string_view(name).starts_with(ScriptFunctionPrefix))
+        {
+            name += ScriptFunctionPrefix.size();
+        }
+
+        GetInstance()->m_scriptOperations.Push(name, AZStd::forward<OperationT>(operation));
+    }
+
+    const AZStd::string& ScriptManager::InternString(AZStd::string_view text)
+    {
+        return GetInstance()->m_scriptOperations.InternString(text);
+    }
+
     void ScriptManager::Activate()
     {
         m_scriptContext = AZStd::make_unique<AZ::ScriptContext>();
@@ -311,7 +332,19 @@ namespace AtomSampleViewer
             m_shouldPopScript = false;
         }
 
-        while (!m_scriptOperations.empty())
+        // Report any screenshot comparisons that finished on the job system since the last frame.
+        m_scriptReporter.ProcessCompletedScreenshotChecks();
+
+        // Record the frame that just finished for any batched frame timing captures.
+        m_frameTimingRecorder.Tick();
+        m_scriptReporter.GetOperationProfiler().Tick();
+
+        // Apply the asset status events received since the last frame, before the script checks them
+        m_assetStatusTracker.ProcessEvents();
+
+        TickCameraPath();
+
+        while (!m_scriptOperations.IsEmpty())
         {
             if (m_shouldPopScript)
             {
@@ -357,6 +390,32 @@ namespace AtomSampleViewer
                 }
             }
 
+            if (m_waitForStableFrames)
+            {
+                if (!TickWaitForStableFrames(deltaTime))
+                {
+                    break;
+                }
+            }
+
+            // Batched captures started in the same frame record the same frames, after that the script waits for them to finish.
+            if (m_frameTimingRecorder.IsRecordingFromPreviousFrame())
+            {
+                break;
+            }
+
+            // Same for camera paths, so captures can be started right after the path
+            if (IsPlayingCameraPath() && !m_cameraPathStartedThisFrame)
+            {
+                break;
+            }
+
+            // Sweep steps wait right away, so no other operation can change the scene while a step is recorded
+            if (m_frameTimingRecorder.IsRecordingSweepStep())
+            {
+                break;
+            }
+
             if (m_scriptIdleFrames > 0)
             {
                 m_scriptIdleFrames--;
@@ -369,12 +428,11 @@ namespace AtomSampleViewer
                 break;
             }
 
-            // Execute the next operation
-            m_scriptOperations.front()();
-
-            m_scriptOperations.pop();
+            // Execute the next operation. Its time in the profile lasts until the next operation starts, to include any wait it caused.
+            m_scriptReporter.GetOperationProfiler().BeginOperation(m_scriptOperations.GetFrontName());
+            m_scriptOperations.PopAndExecute();
 
-            if (m_scriptOperations.empty())
+            if (m_scriptOperations.IsEmpty())
             {
                 m_doFinalScriptCleanup = true;
             }
@@ -390,15 +448,25 @@ namespace AtomSampleViewer
         {
             bool frameCapturePending = false;
             SampleComponentManagerRequestBus::BroadcastResult(frameCapturePending, &SampleComponentManagerRequests::IsFrameCapturePending);
-            if (!frameCapturePending && !m_isCapturePending)
+            if (!frameCapturePending && !m_isCapturePending && !m_frameTimingRecorder.IsRecording() && !IsPlayingCameraPath())
             {
                 AZ_Assert(m_scriptPaused == false, "Script manager is in an unexpected state.");
                 AZ_Assert(m_scriptIdleFrames == 0, "Script manager is in an unexpected state.");
                 AZ_Assert(m_scriptIdleSeconds <= 0.0f, "Script manager is in an unexpected state.");
                 AZ_Assert(m_waitForAssetTracker == false, "Script manager is in an unexpected state.");
+                AZ_Assert(m_waitForStableFrames == false, "Script manager is in an unexpected state.");
                 AZ_Assert(!m_scriptReporter.HasActiveScript(), "Script manager is in an unexpected state.");
                 AZ_Assert(m_executingScripts.size() == 0, "Script manager is in an unexpected state");
 
+                m_scriptReporter.GetOperationProfiler().EndOperation();
+
+                // The queue grows and interns strings while the script queues its operations, so running them shouldn't allocate
+                const size_t executionAllocationCount = m_scriptOperations.GetExecutionAllocationCount() - m_scriptOperationExecutionAllocationsAtStart;
+                if (executionAllocationCount > 0)
+                {
+                    AZ_Printf("Automation", "The script operation queue allocated %zu times while running operations during the run.\n", executionAllocationCount);
+                }
+
                 m_assetStatusTracker.StopTracking();
 
                 if (m_frameTimeIsLocked)
@@ -416,6 +484,9 @@ namespace AtomSampleViewer
                 // In case scripts were aborted while ImGui was temporarily hidden, show it again.
                 SetShowImGui(true);
 
+                // The report isn't final until every screenshot comparison has been reported.
+                m_scriptReporter.WaitForScreenshotChecks();
+
                 m_scriptReporter.SortScriptReports();
                 m_scriptReporter.OpenReportDialog();
 
@@ -426,6 +497,12 @@ namespace AtomSampleViewer
                 {
                     m_testSuiteRunConfig.m_automatedRunEnabled = false;
 
+                    // Each shard exports its results, so they can be merged into one report
+                    m_scriptReporter.ExportTestResultsJson(
+                        aznumeric_cast<uint32_t>(m_testSuiteRunConfig.m_shardIndex), aznumeric_cast<uint32_t>(m_testSuiteRunConfig.m_shardCount));
+                    m_scriptReporter.ExportScriptTrace(AZStd::string::format(
+                        "scriptTrace_shard%dof%d.json", m_testSuiteRunConfig.m_shardIndex, m_testSuiteRunConfig.m_shardCount));
+
                     if (m_scriptReporter.HasErrorsAssertsInReport())
                     {
                         AtomSampleViewerRequestsBus::Broadcast(&AtomSampleViewerRequestsBus::Events::SetExitCode, 1);
@@ -462,24 +539,30 @@ namespace AtomSampleViewer
         m_showPrecommitWizard = true;
     }
 
-    void ScriptManager::RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed)
+    void ScriptManager::RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, int shardIndex, int shardCount)
     {
         m_testSuiteRunConfig.m_automatedRunEnabled = true;
         m_testSuiteRunConfig.m_testSuitePath = suiteFilePath;
         m_testSuiteRunConfig.m_closeOnTestScriptFinish = exitOnTestEnd;
         m_testSuiteRunConfig.m_randomSeed = randomSeed;
+        m_testSuiteRunConfig.m_shardIndex = shardIndex;
+        m_testSuiteRunConfig.m_shardCount = shardCount;
     }
 
     void ScriptManager::AbortScripts(const AZStd::string& reason)
     {
         m_scriptReporter.SetInvalidationMessage(reason);
 
-        m_scriptOperations = {};
+        m_scriptOperations.Clear();
         m_executingScripts.clear();
         m_scriptPaused = false;
         m_scriptIdleFrames = 0;
         m_scriptIdleSeconds = 0.0f;
         m_waitForAssetTracker = false;
+        m_waitForStableFrames = false;
+        m_frameTimingRecorder.FlushAll();
+        m_cameraPathFrameCount = 0;
+        m_scriptReporter.GetOperationProfiler().EndOperation();
         while (m_scriptReporter.HasActiveScript())
         {
             m_scriptReporter.PopScript();
@@ -505,7 +588,7 @@ namespace AtomSampleViewer
             };
 
             // The main buttons are at the bottom, but show the Abort button at the top too, in case the window size is small.
-            if (!m_scriptOperations.empty())
+            if (!m_scriptOperations.IsEmpty())
             {
                 drawAbortButton("Button1");
             }
@@ -525,6 +608,16 @@ namespace AtomSampleViewer
 
             ImGui::InputInt("Random Seed for Test Order Execution", &m_testSuiteRunConfig.m_randomSeed);
 
+            // Lets a shard of a CI run be reproduced locally
+            if (ImGui::InputInt("Test Shard Count", &m_testSuiteRunConfig.m_shardCount))
+            {
+                m_testSuiteRunConfig.m_shardCount = AZStd::max(m_testSuiteRunConfig.m_shardCount, 1);
+            }
+            if (ImGui::InputInt("Test Shard Index", &m_testSuiteRunConfig.m_shardIndex) || m_testSuiteRunConfig.m_shardIndex >= m_testSuiteRunConfig.m_shardCount)
+            {
+                m_testSuiteRunConfig.m_shardIndex = AZStd::clamp(m_testSuiteRunConfig.m_shardIndex, 0, m_testSuiteRunConfig.m_shardCount - 1);
+            }
+
             m_imageComparisonOptions.DrawImGuiSettings();
             if (ImGui::Button("Reset"))
             {
@@ -549,9 +642,12 @@ namespace AtomSampleViewer
                 m_scriptReporter.OpenReportDialog();
             }
 
-            if (m_scriptOperations.size() > 0)
+            if (!m_scriptOperations.IsEmpty())
             {
-                ImGui::LabelText("##RunningScript", "Running %zu operations...", m_scriptOperations.size());
+                ImGui::LabelText("##RunningScript", "Running %zu operations...", m_scriptOperations.GetSize());
+                ImGui::LabelText("##OperationAllocations", "Operation queue allocations: %zu (%zu while running)",
+                    m_scriptOperations.GetAllocationCount() - m_scriptOperationAllocationsAtStart,
+                    m_scriptOperations.GetExecutionAllocationCount() - m_scriptOperationExecutionAllocationsAtStart);
 
                 drawAbortButton("Button2");
             }
@@ -641,7 +737,7 @@ namespace AtomSampleViewer
     {
         ImGui::Text("Running Full Test Suite. Please Wait...");
 
-        if (m_scriptOperations.empty() && !m_doFinalScriptCleanup)
+        if (m_scriptOperations.IsEmpty() && !m_doFinalScriptCleanup)
         {
             m_scriptReporter.HideReportDialog();
             m_wizardSettings.m_stage = PrecommitWizardSettings::Stage::ReportFullsuiteSummary;
@@ -913,6 +1009,9 @@ namespace AtomSampleViewer
 
         // Setup the ScriptReporter to track and report the results
         m_scriptReporter.Reset();
+        m_scriptOperations.ResetInternedStrings();
+        m_scriptOperationAllocationsAtStart = m_scriptOperations.GetAllocationCount();
+        m_scriptOperationExecutionAllocationsAtStart = m_scriptOperations.GetExecutionAllocationCount();
         m_scriptReporter.SetAvailableToleranceLevels(m_imageComparisonOptions.GetAvailableToleranceLevels());
         if (m_imageComparisonOptions.IsLevelAdjusted())
         {
@@ -956,14 +1055,16 @@ namespace AtomSampleViewer
             s_instance->m_imageComparisonOptions.SelectToleranceLevel(nullptr); // Clear the preset before each script to make sure the script is selecting it.
         }
 
+        const AZStd::string& internedScriptFilePath = InternString(scriptFilePath);
+
         // Execute(script) will add commands to the m_scriptOperations. These should be considered part of their own test script, for reporting purposes.
-        s_instance->m_scriptOperations.push([scriptFilePath]()
+        PushScriptOperation("PushScript", [&scriptFilePath = internedScriptFilePath]()
             {
                 GetInstance()->m_scriptReporter.PushScript(scriptFilePath);
             }
         );
 
-        s_instance->m_scriptOperations.push([scriptFilePath]()
+        PushScriptOperation("PushScript", [&scriptFilePath = internedScriptFilePath]()
             {
                 AZ_Printf("Automation", "Running script '%s'...\n", scriptFilePath.c_str());
             }
@@ -982,7 +1083,7 @@ namespace AtomSampleViewer
         s_instance->m_executingScripts.erase(scriptAsset.GetId());
 
         // Execute(script) will have added commands to the m_scriptOperations. When they finish, consider this test as completed, for reporting purposes.
-        s_instance->m_scriptOperations.push([]()
+        PushScriptOperation("PopScript", []()
             {
                 // We don't call m_scriptReporter.PopScript() yet because some cleanup needs to happen in TickScript() on the next frame.
                 AZ_Assert(!GetInstance()->m_shouldPopScript, "m_shouldPopScript is already true");
@@ -1072,6 +1173,13 @@ namespace AtomSampleViewer
         behaviorContext->Method("Print", &Script_Print);
         behaviorContext->Method("IdleFrames", &Script_IdleFrames);
         behaviorContext->Method("IdleSeconds", &Script_IdleSeconds);
+
+        AZ::BehaviorParameterOverrides maxVariationDetails = {"maxVariation", "Highest frame time coefficient of variation that counts as stable; default=0.05",
+            aznew AZ::BehaviorDefaultValue(DefaultStableFrameTimeVariation)};
+        AZ::BehaviorParameterOverrides stableTimeoutDetails = {"timeout", "Seconds to wait at most; default=30", aznew AZ::BehaviorDefaultValue(DefaultStableTimeout)};
+        const AZStd::array<AZ::BehaviorParameterOverrides, 2> idleUntilStableArgs = {{ maxVariationDetails, stableTimeoutDetails }};
+        behaviorContext->Method("IdleUntilStable", &Script_IdleUntilStable, idleUntilStableArgs);
+
         behaviorContext->Method("LockFrameTime", &Script_LockFrameTime);
         behaviorContext->Method("UnlockFrameTime", &Script_UnlockFrameTime);
         behaviorContext->Method("ResizeViewport", &Script_ResizeViewport);
@@ -1084,6 +1192,8 @@ namespace AtomSampleViewer
         behaviorContext->Method("DegToRad", &Script_DegToRad);
         behaviorContext->Method("GetRenderApiName", &Script_GetRenderApiName);
         behaviorContext->Method("GetRandomTestSeed", &Script_GetRandomTestSeed);
+        behaviorContext->Method("GetTestShardIndex", &Script_GetTestShardIndex);
+        behaviorContext->Method("GetTestShardCount", &Script_GetTestShardCount);
 
         // Samples...
         behaviorContext->Method("OpenSample", &Script_OpenSample);
@@ -1106,9 +1216,13 @@ namespace AtomSampleViewer
         // Profiling data...
         behaviorContext->Method("CapturePassTimestamp", &Script_CapturePassTimestamp);
         behaviorContext->Method("CaptureCpuFrameTime", &Script_CaptureCpuFrameTime);
+        behaviorContext->Method("CapturePassTimestamps", &Script_CapturePassTimestamps);
+        behaviorContext->Method("CaptureCpuFrameTimes", &Script_CaptureCpuFrameTimes);
         behaviorContext->Method("CapturePassPipelineStatistics", &Script_CapturePassPipelineStatistics);
         behaviorContext->Method("CaptureCpuProfilingStatistics", &Script_CaptureCpuProfilingStatistics);
         behaviorContext->Method("CaptureBenchmarkMetadata", &Script_CaptureBenchmarkMetadata);
+        behaviorContext->Method("SweepBenchmark", &Script_SweepBenchmark);
+        behaviorContext->Method("BenchmarkAssetStatusTracker", &Script_BenchmarkAssetStatusTracker);
 
         // Camera...
         behaviorContext->Method("ArcBallCameraController_SetCenter", &Script_ArcBallCameraController_SetCenter);
@@ -1120,6 +1234,7 @@ namespace AtomSampleViewer
         behaviorContext->Method("NoClipCameraController_SetHeading", &Script_NoClipCameraController_SetHeading);
         behaviorContext->Method("NoClipCameraController_SetPitch", &Script_NoClipCameraController_SetPitch);
         behaviorContext->Method("NoClipCameraController_SetFov", &Script_NoClipCameraController_SetFov);
+        behaviorContext->Method("PlayCameraPath", &Script_PlayCameraPath);
 
         // Asset System...
         AZ::BehaviorParameterOverrides expectedCountDetails = {"expectedCount", "Expected number of asset jobs; default=1", aznew AZ::BehaviorDefaultValue(1u)};
@@ -1133,31 +1248,31 @@ namespace AtomSampleViewer
 
     void ScriptManager::Script_Error(const AZStd::string& message)
     {
-        auto func = [message]()
+        auto func = [&message = InternString(message)]()
         {
             ReportScriptError(message.c_str());
         };
-        GetInstance()->m_scriptOperations.push(AZStd::move(func));
+        PushScriptOperation(__func__, AZStd::move(func));
     }
 
     void ScriptManager::Script_Warning(const AZStd::string& message)
     {
-        auto func = [message]()
+        auto func = [&message = InternString(message)]()
         {
             ReportScriptWarning(message.c_str());
         };
-        GetInstance()->m_scriptOperations.push(AZStd::move(func));
+        PushScriptOperation(__func__, AZStd::move(func));
     }
 
     void ScriptManager::Script_Print(const AZStd::string& message [[maybe_unused]])
     {
 #ifndef RELEASE // AZ_TracePrintf is a no-op in release builds
-        auto func = [message]()
+        auto func = [&message = InternString(message)]()
         {
             AZ_TracePrintf("Automation", "Script: %s\n", message.c_str());
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(func));
+        PushScriptOperation(__func__, AZStd::move(func));
 #endif
     }
 
@@ -1175,7 +1290,7 @@ namespace AtomSampleViewer
 
     void ScriptManager::Script_OpenSample(const AZStd::string& sampleName)
     {
-        auto operation = [sampleName]()
+        auto operation = [&sampleName = InternString(sampleName)]()
         {
             if (sampleName.empty())
             {
@@ -1199,12 +1314,12 @@ namespace AtomSampleViewer
             }
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_ShowTool(const AZStd::string& toolName, bool enable)
     {
-        auto operation = [toolName, enable]()
+        auto operation = [&toolName = InternString(toolName), enable]()
         {
             bool foundTool = false;
             SampleComponentManagerRequestBus::BroadcastResult(foundTool, &SampleComponentManagerRequests::ShowTool, toolName, enable);
@@ -1212,7 +1327,7 @@ namespace AtomSampleViewer
             AZ_Warning("ScriptManager", foundTool, "Can't find [%s] tool", toolName.c_str());
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_RunScript(const AZStd::string& scriptFilePath)
@@ -1230,7 +1345,7 @@ namespace AtomSampleViewer
             GetInstance()->m_scriptIdleFrames = numFrames;
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_IdleSeconds(float numSeconds)
@@ -1240,7 +1355,76 @@ namespace AtomSampleViewer
             GetInstance()->m_scriptIdleSeconds = numSeconds;
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_IdleUntilStable(float maxVariation, float timeout)
+    {
+        auto operation = [maxVariation, timeout]()
+        {
+            GetInstance()->StartWaitForStableFrames(maxVariation, timeout);
+        };
+
+        PushScriptOperation(__func__, AZStd::move(operation));
+    }
+
+    void ScriptManager::StartWaitForStableFrames(float maxVariation, float timeout)
+    {
+        AZ_Assert(!m_waitForStableFrames, "It shouldn't be possible to run the next command until m_waitForStableFrames is false");
+
+        m_waitForStableFrames = true;
+        m_stableFramesTimeout = timeout;
+        m_maxStableFrameTimeVariation = maxVariation;
+        m_stableFrameCount = 0;
+        m_skipStableFrame = true;
+    }
+
+    bool ScriptManager::TickWaitForStableFrames(float deltaTime)
+    {
+        m_stableFramesTimeout -= deltaTime;
+
+        // The CPU frame time is of the previous frame, which is the one where the wait started, so it doesn't reflect the new state yet
+        if (m_skipStableFrame)
+        {
+            m_skipStableFrame = false;
+            return false;
+        }
+
+        m_stableFrameTimesMs[m_stableFrameCount % StableFrameWindow] = AZ::RHI::RHISystemInterface::Get()->GetCpuFrameTime();
+        ++m_stableFrameCount;
+
+        const uint32_t windowSize = AZStd::min(m_stableFrameCount, StableFrameWindow);
+        double mean = 0.0;
+        for (uint32_t i = 0; i < windowSize; ++i)
+        {
+            mean += m_stableFrameTimesMs[i];
+        }
+        mean /= windowSize;
+
+        double sumOfSquaredDeviations = 0.0;
+        for (uint32_t i = 0; i < windowSize; ++i)
+        {
+            const double deviation = m_stableFrameTimesMs[i] - mean;
+            sumOfSquaredDeviations += deviation * deviation;
+        }
+        const double variation = mean > 0.0 && windowSize > 1 ? AZStd::sqrt(sumOfSquaredDeviations / (windowSize - 1)) / mean : 0.0;
+
+        const bool assetsLoading = AZ::Data::AssetManager::Instance().HasActiveJobsOrStreamerRequests();
+        const uint32_t assetJobCount = m_assetStatusTracker.GetActiveJobCount();
+
+        if (m_stableFrameCount >= StableFrameWindow && variation <= m_maxStableFrameTimeVariation && !assetsLoading && assetJobCount == 0)
+        {
+            AZ_Printf("Automation", "Frame time stabilized after %u frames with a coefficient of variation of %.3f.\n", m_stableFrameCount, variation);
+            m_waitForStableFrames = false;
+        }
+        else if (m_stableFramesTimeout < 0)
+        {
+            AZ_Warning("Automation", false, "IdleUntilStable timed out after %u frames. Frame time coefficient of variation %.3f, assets loading: %s, "
+                "Asset Processor jobs: %u. Continuing...", m_stableFrameCount, variation, assetsLoading ? "yes" : "no", assetJobCount);
+            m_waitForStableFrames = false;
+        }
+
+        return !m_waitForStableFrames;
     }
 
     void ScriptManager::Script_LockFrameTime(float seconds)
@@ -1254,7 +1438,7 @@ namespace AtomSampleViewer
             GetInstance()->m_frameTimeIsLocked = true;
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_UnlockFrameTime()
@@ -1265,7 +1449,7 @@ namespace AtomSampleViewer
             GetInstance()->m_frameTimeIsLocked = false;
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_SetImguiValue(AZ::ScriptDataContext& dc)
@@ -1285,7 +1469,8 @@ namespace AtomSampleViewer
         const char* fieldName = nullptr;
         dc.ReadArg(0, fieldName);
 
-        AZStd::string fieldNameString = fieldName; // Because the lambda will need to capture a copy of something, not a pointer
+        // The lambda will need to capture a copy of something, not a pointer
+        const AZStd::string_view fieldNameString = InternString(fieldName);
 
         if (dc.IsBoolean(1))
         {
@@ -1297,7 +1482,7 @@ namespace AtomSampleViewer
                 ScriptableImGui::SetBool(fieldNameString, value);
             };
 
-            GetInstance()->m_scriptOperations.push(AZStd::move(func));
+            PushScriptOperation(__func__, AZStd::move(func));
         }
         else if (dc.IsNumber(1))
         {
@@ -1309,21 +1494,21 @@ namespace AtomSampleViewer
                 ScriptableImGui::SetNumber(fieldNameString, value);
             };
 
-            GetInstance()->m_scriptOperations.push(AZStd::move(func));
+            PushScriptOperation(__func__, AZStd::move(func));
         }
         else if (dc.IsString(1))
         {
             const char* value = nullptr;
             dc.ReadArg(1, value);
 
-            AZStd::string valueString = value; // Because the lambda will need to capture a copy of something, not a pointer
+            const AZStd::string_view valueString = InternString(value);
 
             auto func = [fieldNameString, valueString]()
             {
                 ScriptableImGui::SetString(fieldNameString, valueString);
             };
 
-            GetInstance()->m_scriptOperations.push(AZStd::move(func));
+            PushScriptOperation(__func__, AZStd::move(func));
         }
         else if (dc.IsClass<AZ::Vector3>(1))
         {
@@ -1335,7 +1520,7 @@ namespace AtomSampleViewer
                 ScriptableImGui::SetVector(fieldNameString, value);
             };
 
-            GetInstance()->m_scriptOperations.push(AZStd::move(func));
+            PushScriptOperation(__func__, AZStd::move(func));
         }
         else if (dc.IsClass<AZ::Vector2>(1))
         {
@@ -1347,7 +1532,7 @@ namespace AtomSampleViewer
                 ScriptableImGui::SetVector(fieldNameString, value);
             };
 
-            GetInstance()->m_scriptOperations.push(AZStd::move(func));
+            PushScriptOperation(__func__, AZStd::move(func));
         }
     }
 
@@ -1367,17 +1552,17 @@ namespace AtomSampleViewer
             }
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_ExecuteConsoleCommand(const AZStd::string& command)
     {
-        auto operation = [command]()
+        auto operation = [&command = InternString(command)]()
         {
             AZ::Interface<AZ::IConsole>::Get()->PerformCommand(command.c_str());
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::SetShowImGui(bool show)
@@ -1401,7 +1586,7 @@ namespace AtomSampleViewer
             GetInstance()->SetShowImGui(show);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     bool ScriptManager::PrepareForScreenCapture(const AZStd::string& imageName)
@@ -1439,63 +1624,63 @@ namespace AtomSampleViewer
 
     void ScriptManager::Script_SetScreenshotFolder(const AZStd::string& screenshotFolder)
     {
-        auto operation = [screenshotFolder]()
+        auto operation = [&screenshotFolder = InternString(screenshotFolder)]()
         {
             AZ::Render::FrameCaptureTestRequestBus::Broadcast(
                 &AZ::Render::FrameCaptureTestRequestBus::Events::SetScreenshotFolder, screenshotFolder);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_SetTestEnvPath(const AZStd::string& envPath)
     {
-        auto operation = [envPath]()
+        auto operation = [&envPath = InternString(envPath)]()
         {
             AZ::Render::FrameCaptureTestRequestBus::Broadcast(
                 &AZ::Render::FrameCaptureTestRequestBus::Events::SetTestEnvPath, envPath);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_SetOfficialBaselineImageFolder(const AZStd::string& baselineFolder)
     {
-        auto operation = [baselineFolder]()
+        auto operation = [&baselineFolder = InternString(baselineFolder)]()
         {
             AZ::Render::FrameCaptureTestRequestBus::Broadcast(
                 &AZ::Render::FrameCaptureTestRequestBus::Events::SetOfficialBaselineImageFolder, baselineFolder);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_SetLocalBaselineImageFolder(const AZStd::string& baselineFolder)
     {
-        auto operation = [baselineFolder]()
+        auto operation = [&baselineFolder = InternString(baselineFolder)]()
         {
             AZ::Render::FrameCaptureTestRequestBus::Broadcast(
                 &AZ::Render::FrameCaptureTestRequestBus::Events::SetLocalBaselineImageFolder, baselineFolder);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_SelectImageComparisonToleranceLevel(const AZStd::string& presetName)
     {
-        auto operation = [presetName]()
+        auto operation = [&presetName = InternString(presetName)]()
         {
             GetInstance()->m_imageComparisonOptions.SelectToleranceLevel(presetName);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_CaptureScreenshot(const AZStd::string& imageName)
     {
         Script_SetShowImGui(false);
 
-        auto operation = [imageName]()
+        auto operation = [&imageName = InternString(imageName)]()
         {
             ScriptManager* s_instance = GetInstance();
 
@@ -1539,14 +1724,14 @@ namespace AtomSampleViewer
         };
 
         ScriptManager* s_instance = GetInstance();
-        s_instance->m_scriptOperations.push(AZStd::move(operation));
-        s_instance->m_scriptOperations.push([]()
+        PushScriptOperation(__func__, AZStd::move(operation));
+        PushScriptOperation("CheckScreenshot", []()
             {
                 GetInstance()->m_scriptReporter.CheckLatestScreenshot(GetInstance()->m_imageComparisonOptions.GetCurrentToleranceLevel());
             });
 
         // restore imgui show/hide
-        s_instance->m_scriptOperations.push([]()
+        PushScriptOperation("RestoreImGui", []()
             {
                 GetInstance()->SetShowImGui(GetInstance()->m_prevShowImGui);
             });
@@ -1557,7 +1742,7 @@ namespace AtomSampleViewer
     {
         Script_SetShowImGui(true);
 
-        auto operation = [imageName]()
+        auto operation = [&imageName = InternString(imageName)]()
         {
             ScriptManager* s_instance = GetInstance();
 
@@ -1602,14 +1787,14 @@ namespace AtomSampleViewer
 
         ScriptManager* s_instance = GetInstance();
 
-        s_instance->m_scriptOperations.push(AZStd::move(operation));
-        s_instance->m_scriptOperations.push([]()
+        PushScriptOperation(__func__, AZStd::move(operation));
+        PushScriptOperation("CheckScreenshot", []()
             {
                 GetInstance()->m_scriptReporter.CheckLatestScreenshot(GetInstance()->m_imageComparisonOptions.GetCurrentToleranceLevel());
             });
 
         // restore imgui show/hide
-        s_instance->m_scriptOperations.push([]()
+        PushScriptOperation("RestoreImGui", []()
             {
                 GetInstance()->SetShowImGui(GetInstance()->m_prevShowImGui);
             });
@@ -1617,7 +1802,7 @@ namespace AtomSampleViewer
 
     void ScriptManager::Script_CaptureScreenshotWithPreview(const AZStd::string& imageName)
     {
-        auto operation = [imageName]()
+        auto operation = [&imageName = InternString(imageName)]()
         {
             ScriptManager* s_instance = GetInstance();
 
@@ -1661,8 +1846,8 @@ namespace AtomSampleViewer
         };
 
         ScriptManager* s_instance = GetInstance();
-        s_instance->m_scriptOperations.push(AZStd::move(operation));
-        s_instance->m_scriptOperations.push([]()
+        PushScriptOperation(__func__, AZStd::move(operation));
+        PushScriptOperation("CheckScreenshot", []()
             {
                 GetInstance()->m_scriptReporter.CheckLatestScreenshot(GetInstance()->m_imageComparisonOptions.GetCurrentToleranceLevel());
             });
@@ -1743,7 +1928,7 @@ namespace AtomSampleViewer
             }
         }
 
-        auto operation = [passHierarchy, slot, imageName, readbackOption]()
+        auto operation = [passHierarchy = AZStd::move(passHierarchy), &slot = InternString(slot), &imageName = InternString(imageName), readbackOption]()
         {
             ScriptManager* s_instance = GetInstance();
 
@@ -1787,8 +1972,8 @@ namespace AtomSampleViewer
             }
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
-        GetInstance()->m_scriptOperations.push([]()
+        PushScriptOperation(__func__, AZStd::move(operation));
+        PushScriptOperation("CheckScreenshot", []()
             {
                 GetInstance()->m_scriptReporter.CheckLatestScreenshot(GetInstance()->m_imageComparisonOptions.GetCurrentToleranceLevel());
             });
@@ -1855,7 +2040,7 @@ namespace AtomSampleViewer
             return;
         }
 
-        auto operation = [outputFilePath]()
+        auto operation = [&outputFilePath = InternString(outputFilePath)]()
         {
             GetInstance()->m_isCapturePending = true;
             GetInstance()->AZ::Render::ProfilingCaptureNotificationBus::Handler::BusConnect();
@@ -1864,7 +2049,7 @@ namespace AtomSampleViewer
             AZ::Render::ProfilingCaptureRequestBus::Broadcast(&AZ::Render::ProfilingCaptureRequestBus::Events::CapturePassTimestamp, outputFilePath);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_CaptureCpuFrameTime(AZ::ScriptDataContext& dc)
@@ -1876,7 +2061,7 @@ namespace AtomSampleViewer
             return;
         }
 
-        auto operation = [outputFilePath]()
+        auto operation = [&outputFilePath = InternString(outputFilePath)]()
         {
             GetInstance()->m_isCapturePending = true;
             GetInstance()->AZ::Render::ProfilingCaptureNotificationBus::Handler::BusConnect();
@@ -1885,7 +2070,252 @@ namespace AtomSampleViewer
             AZ::Render::ProfilingCaptureRequestBus::Broadcast(&AZ::Render::ProfilingCaptureRequestBus::Events::CaptureCpuFrameTime, outputFilePath);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_CapturePassTimestamps(int frameCount, const AZStd::string& outputFilePath)
+    {
+        if (frameCount <= 0)
+        {
+            ReportScriptError("CapturePassTimestamps needs a frame count greater than 0.");
+            return;
+        }
+
+        auto operation = [frameCount, &outputFilePath = InternString(outputFilePath)]()
+        {
+            GetInstance()->m_frameTimingRecorder.StartPassTimestamps(aznumeric_cast<uint32_t>(frameCount), outputFilePath);
+        };
+
+        PushScriptOperation(__func__, AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_CaptureCpuFrameTimes(int frameCount, const AZStd::string& outputFilePath)
+    {
+        if (frameCount <= 0)
+        {
+            ReportScriptError("CaptureCpuFrameTimes needs a frame count greater than 0.");
+            return;
+        }
+
+        auto operation = [frameCount, &outputFilePath = InternString(outputFilePath)]()
+        {
+            GetInstance()->m_frameTimingRecorder.StartCpuFrameTimes(aznumeric_cast<uint32_t>(frameCount), outputFilePath);
+        };
+
+        PushScriptOperation(__func__, AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_SweepBenchmark(AZ::ScriptDataContext& dc)
+    {
+        if (dc.GetNumArguments() < 4 || dc.GetNumArguments() > 6)
+        {
+            ReportScriptError("SweepBenchmark needs four to six arguments");
+            return;
+        }
+
+        if (!dc.IsString(0) || !dc.IsString(1))
+        {
+            ReportScriptError("SweepBenchmark's first and second argument must be strings");
+            return;
+        }
+
+        if (!dc.IsTable(2))
+        {
+            ReportScriptError("SweepBenchmark's third argument must be a table of numbers");
+            return;
+        }
+
+        if (!dc.IsNumber(3))
+        {
+            ReportScriptError("SweepBenchmark's fourth argument must be a number");
+            return;
+        }
+
+        if (dc.GetNumArguments() >= 5 && !dc.IsString(4) && !(dc.GetNumArguments() == 5 && dc.IsTable(4)))
+        {
+            ReportScriptError("SweepBenchmark's fifth argument must be a string, or the table of setup fields when it's the last argument");
+            return;
+        }
+
+        if (dc.GetNumArguments() == 6 && !dc.IsTable(5))
+        {
+            ReportScriptError("SweepBenchmark's sixth argument must be a table of setup fields");
+            return;
+        }
+
+        const bool hasOutputFilePath = dc.GetNumArguments() >= 5 && dc.IsString(4);
+        const int setupFieldsIndex = dc.GetNumArguments() == 6 ? 5 : (dc.GetNumArguments() == 5 && !hasOutputFilePath ? 4 : -1);
+
+        AZStd::string sampleName;
+        AZStd::string parameterName;
+        int frameCount = 0;
+        dc.ReadArg(0, sampleName);
+        dc.ReadArg(1, parameterName);
+        dc.ReadArg(3, frameCount);
+
+        if (frameCount <= 0)
+        {
+            ReportScriptError("SweepBenchmark needs a frame count greater than 0.");
+            return;
+        }
+
+        AZStd::string outputFilePath;
+        if (hasOutputFilePath)
+        {
+            dc.ReadArg(4, outputFilePath);
+        }
+        else
+        {
+            // Parameter names are ImGui labels, which often start with "##", so keep only the characters that are safe in a file name
+            AZStd::string fileName = "sweep_";
+            for (char c : parameterName)
+            {
+                if (isalnum(static_cast<unsigned char>(c)))
+                {
+                    fileName += c;
+                }
+                else if (fileName.back() != '_')
+                {
+                    fileName += '_';
+                }
+            }
+
+            AZStd::string sampleFolder = sampleName.substr(sampleName.find_last_of('/') + 1);
+            outputFilePath = AZStd::string::format("@user@/scripts/PerformanceBenchmarks/%s/%s.csv", sampleFolder.c_str(), fileName.c_str());
+        }
+        outputFilePath = Script_ResolvePath(outputFilePath);
+
+        // read parameter values
+        AZStd::vector<float> values;
+
+        AZ::ScriptDataContext valueTable;
+        dc.InspectTable(2, valueTable);
+
+        const char* fieldName;
+        int fieldIndex;
+        int elementIndex;
+
+        while (valueTable.InspectNextElement(elementIndex, fieldName, fieldIndex))
+        {
+            if (fieldIndex != -1)
+            {
+                if (!valueTable.IsNumber(elementIndex))
+                {
+                    ReportScriptError("SweepBenchmark's third argument must contain only numbers");
+                    return;
+                }
+
+                float value = 0.0f;
+                if (valueTable.ReadValue(elementIndex, value))
+                {
+                    values.push_back(value);
+                }
+            }
+        }
+
+        if (values.empty())
+        {
+            ReportScriptError("SweepBenchmark needs at least one parameter value");
+            return;
+        }
+
+        // read the fields to set after the sample opens, such as a button that reveals the controls of the parameter
+        AZStd::vector<AZStd::string> setupFields;
+        if (setupFieldsIndex != -1)
+        {
+            AZ::ScriptDataContext setupTable;
+            dc.InspectTable(setupFieldsIndex, setupTable);
+
+            while (setupTable.InspectNextElement(elementIndex, fieldName, fieldIndex))
+            {
+                if (fieldIndex != -1)
+                {
+                    const char* setupField = nullptr;
+                    if (!setupTable.IsString(elementIndex) || !setupTable.ReadValue(elementIndex, setupField))
+                    {
+                        ReportScriptError("SweepBenchmark's setup fields must be strings");
+                        return;
+                    }
+                    setupFields.push_back(setupField);
+                }
+            }
+        }
+
+        Script_OpenSample(sampleName);
+
+        if (!setupFields.empty())
+        {
+            for (const AZStd::string& setupField : setupFields)
+            {
+                auto setupOperation = [&setupField = InternString(setupField)]()
+                {
+                    ScriptableImGui::SetBool(setupField, true);
+                };
+                PushScriptOperation(__func__, AZStd::move(setupOperation));
+            }
+
+            // The sample consumes the setup fields on its next frame, so controls they reveal are only drawn the frame after
+            Script_IdleFrames(2);
+        }
+
+        auto startOperation = [&parameterName = InternString(parameterName), &outputFilePath = InternString(outputFilePath)]()
+        {
+            GetInstance()->m_frameTimingRecorder.StartSweep(parameterName, outputFilePath);
+        };
+
+        PushScriptOperation(__func__, AZStd::move(startOperation));
+
+        for (float value : values)
+        {
+            auto setValueOperation = [&parameterName = InternString(parameterName), value]()
+            {
+                ScriptableImGui::SetNumber(parameterName, value);
+                GetInstance()->StartWaitForStableFrames(DefaultStableFrameTimeVariation, DefaultStableTimeout);
+            };
+
+            auto recordOperation = [value, frameCount]()
+            {
+                GetInstance()->m_frameTimingRecorder.StartSweepStep(value, aznumeric_cast<uint32_t>(frameCount));
+            };
+
+            PushScriptOperation(__func__, AZStd::move(setValueOperation));
+            PushScriptOperation(__func__, AZStd::move(recordOperation));
+        }
+
+        auto endOperation = []()
+        {
+            GetInstance()->m_frameTimingRecorder.EndSweep();
+        };
+
+        PushScriptOperation(__func__, AZStd::move(endOperation));
+    }
+
+    void ScriptManager::Script_BenchmarkAssetStatusTracker(int eventCount, int threadCount, int eventQueueCapacity)
+    {
+        if (eventCount <= 0 || threadCount <= 0 || eventQueueCapacity <= 0)
+        {
+            ReportScriptError("BenchmarkAssetStatusTracker arguments must be positive");
+            return;
+        }
+
+        auto operation = [eventCount, threadCount, eventQueueCapacity]()
+        {
+            const AssetStatusTracker::BenchmarkResult result = AssetStatusTracker::RunBenchmark(
+                static_cast<uint32_t>(eventCount), static_cast<uint32_t>(threadCount), static_cast<size_t>(eventQueueCapacity));
+
+            AZ_TracePrintf("Automation", "AssetStatusTracker benchmark: %u events from %u threads, queue capacity %zu, %zu overflowed. "
+                "Push: %.3f ms (%.1f Mevents/s), ProcessEvents: %.3f ms\n",
+                result.m_eventCount, result.m_threadCount, result.m_eventQueueCapacity, result.m_overflowEventCount,
+                result.m_pushSeconds * 1000.0, result.m_eventCount / AZStd::max(result.m_pushSeconds, 1e-9) / 1'000'000.0,
+                result.m_processSeconds * 1000.0);
+
+            if (!result.m_allEventsApplied)
+            {
+                ReportScriptError("AssetStatusTracker benchmark: ProcessEvents() didn't apply every pushed event");
+            }
+        };
+
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_CapturePassPipelineStatistics(AZ::ScriptDataContext& dc)
@@ -1897,7 +2327,7 @@ namespace AtomSampleViewer
             return;
         }
 
-        auto operation = [outputFilePath]()
+        auto operation = [&outputFilePath = InternString(outputFilePath)]()
         {
             GetInstance()->m_isCapturePending = true;
             GetInstance()->AZ::Render::ProfilingCaptureNotificationBus::Handler::BusConnect();
@@ -1906,7 +2336,7 @@ namespace AtomSampleViewer
             AZ::Render::ProfilingCaptureRequestBus::Broadcast(&AZ::Render::ProfilingCaptureRequestBus::Events::CapturePassPipelineStatistics, outputFilePath);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_CaptureCpuProfilingStatistics(AZ::ScriptDataContext& dc)
@@ -1918,7 +2348,7 @@ namespace AtomSampleViewer
             return;
         }
 
-        auto operation = [outputFilePath]()
+        auto operation = [&outputFilePath = InternString(outputFilePath)]()
         {
             GetInstance()->m_isCapturePending = true;
             GetInstance()->AZ::Debug::ProfilerNotificationBus::Handler::BusConnect();
@@ -1930,7 +2360,7 @@ namespace AtomSampleViewer
             }
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_CaptureBenchmarkMetadata(AZ::ScriptDataContext& dc)
@@ -1956,7 +2386,7 @@ namespace AtomSampleViewer
         dc.ReadArg(1, stringValue);
         outputFilePath = AZStd::string(stringValue);
 
-        auto operation = [benchmarkName, outputFilePath]()
+        auto operation = [&benchmarkName = InternString(benchmarkName), &outputFilePath = InternString(outputFilePath)]()
         {
             GetInstance()->m_isCapturePending = true;
             GetInstance()->AZ::Render::ProfilingCaptureNotificationBus::Handler::BusConnect();
@@ -1965,7 +2395,7 @@ namespace AtomSampleViewer
             AZ::Render::ProfilingCaptureRequestBus::Broadcast(&AZ::Render::ProfilingCaptureRequestBus::Events::CaptureBenchmarkMetadata, benchmarkName, outputFilePath);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     bool ScriptManager::ValidateProfilingCaptureScripContexts(AZ::ScriptDataContext& dc, AZStd::string& outputFilePath)
@@ -2012,6 +2442,16 @@ namespace AtomSampleViewer
         return GetInstance()->m_testSuiteRunConfig.m_randomSeed;
     }
 
+    int ScriptManager::Script_GetTestShardIndex()
+    {
+        return GetInstance()->m_testSuiteRunConfig.m_shardIndex;
+    }
+
+    int ScriptManager::Script_GetTestShardCount()
+    {
+        return GetInstance()->m_testSuiteRunConfig.m_shardCount;
+    }
+
     void ScriptManager::CheckArcBallControllerHandler()
     {
         if (0 == AZ::Debug::ArcBallControllerRequestBus::GetNumOfEventHandlers(GetInstance()->m_cameraEntity->GetId()))
@@ -2036,7 +2476,7 @@ namespace AtomSampleViewer
             AZ::Debug::ArcBallControllerRequestBus::Event(GetInstance()->m_cameraEntity->GetId(), &AZ::Debug::ArcBallControllerRequestBus::Events::SetCenter, center);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_ArcBallCameraController_SetPan(AZ::Vector3 pan)
@@ -2047,7 +2487,7 @@ namespace AtomSampleViewer
             AZ::Debug::ArcBallControllerRequestBus::Event(GetInstance()->m_cameraEntity->GetId(), &AZ::Debug::ArcBallControllerRequestBus::Events::SetPan, pan);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_ArcBallCameraController_SetDistance(float distance)
@@ -2058,7 +2498,7 @@ namespace AtomSampleViewer
             AZ::Debug::ArcBallControllerRequestBus::Event(GetInstance()->m_cameraEntity->GetId(), &AZ::Debug::ArcBallControllerRequestBus::Events::SetDistance, distance);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_ArcBallCameraController_SetHeading(float heading)
@@ -2069,7 +2509,7 @@ namespace AtomSampleViewer
             AZ::Debug::ArcBallControllerRequestBus::Event(GetInstance()->m_cameraEntity->GetId(), &AZ::Debug::ArcBallControllerRequestBus::Events::SetHeading, heading);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_ArcBallCameraController_SetPitch(float pitch)
@@ -2080,7 +2520,7 @@ namespace AtomSampleViewer
             AZ::Debug::ArcBallControllerRequestBus::Event(GetInstance()->m_cameraEntity->GetId(), &AZ::Debug::ArcBallControllerRequestBus::Events::SetPitch, pitch);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_NoClipCameraController_SetPosition(AZ::Vector3 position)
@@ -2091,7 +2531,7 @@ namespace AtomSampleViewer
             AZ::Debug::NoClipControllerRequestBus::Event(GetInstance()->m_cameraEntity->GetId(), &AZ::Debug::NoClipControllerRequestBus::Events::SetPosition, position);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_NoClipCameraController_SetHeading(float heading)
@@ -2102,7 +2542,7 @@ namespace AtomSampleViewer
             AZ::Debug::NoClipControllerRequestBus::Event(GetInstance()->m_cameraEntity->GetId(), &AZ::Debug::NoClipControllerRequestBus::Events::SetHeading, heading);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_NoClipCameraController_SetPitch(float pitch)
@@ -2113,7 +2553,7 @@ namespace AtomSampleViewer
             AZ::Debug::NoClipControllerRequestBus::Event(GetInstance()->m_cameraEntity->GetId(), &AZ::Debug::NoClipControllerRequestBus::Events::SetPitch, pitch);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_NoClipCameraController_SetFov(float fov)
@@ -2124,7 +2564,61 @@ namespace AtomSampleViewer
             AZ::Debug::NoClipControllerRequestBus::Event(GetInstance()->m_cameraEntity->GetId(), &AZ::Debug::NoClipControllerRequestBus::Events::SetFov, fov);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_PlayCameraPath(const AZStd::string& productPath)
+    {
+        auto operation = [&productPath = InternString(productPath)]()
+        {
+            ScriptManager* scriptManager = GetInstance();
+
+            auto loadOutcome = CameraPath::LoadFromAsset(productPath);
+            if (!loadOutcome.IsSuccess())
+            {
+                ReportScriptError(loadOutcome.GetError());
+                return;
+            }
+
+            CheckNoClipControllerHandler();
+
+            scriptManager->m_cameraPath = loadOutcome.TakeValue();
+            scriptManager->m_cameraPathFrame = 0;
+            scriptManager->m_cameraPathFrameCount = scriptManager->m_cameraPath.GetFrameCount();
+            scriptManager->m_cameraPathStartedThisFrame = true;
+            scriptManager->ApplyCameraPathFrame();
+        };
+
+        PushScriptOperation(__func__, AZStd::move(operation));
+    }
+
+    void ScriptManager::TickCameraPath()
+    {
+        m_cameraPathStartedThisFrame = false;
+
+        if (IsPlayingCameraPath())
+        {
+            ++m_cameraPathFrame;
+            ApplyCameraPathFrame();
+        }
+    }
+
+    void ScriptManager::ApplyCameraPathFrame()
+    {
+        AZ::Vector3 position;
+        AZ::Vector3 target;
+        m_cameraPath.Evaluate(m_cameraPath.GetTimeAtFrame(m_cameraPathFrame), position, target);
+
+        // The NoClip controller looks down +Y, turned by heading around Z and then by pitch around X
+        const AZ::Vector3 direction = target - position;
+        const float horizontalLength = AZStd::sqrt(direction.GetX() * direction.GetX() + direction.GetY() * direction.GetY());
+        const float heading = AZStd::atan2(-direction.GetX(), direction.GetY());
+        const float pitch = AZStd::atan2(direction.GetZ(), horizontalLength);
+
+        const AZ::EntityId cameraEntityId = m_cameraEntity->GetId();
+        AZ::Debug::NoClipControllerRequestBus::Event(cameraEntityId, &AZ::Debug::NoClipControllerRequestBus::Events::SetPosition, position);
+        AZ::Debug::NoClipControllerRequestBus::Event(cameraEntityId, &AZ::Debug::NoClipControllerRequestBus::Events::SetHeading, heading);
+        AZ::Debug::NoClipControllerRequestBus::Event(cameraEntityId, &AZ::Debug::NoClipControllerRequestBus::Events::SetPitch, pitch);
     }
 
     void ScriptManager::Script_AssetTracking_Start()
@@ -2134,18 +2628,18 @@ namespace AtomSampleViewer
             GetInstance()->m_assetStatusTracker.StartTracking();
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
 
     void ScriptManager::Script_AssetTracking_ExpectAsset(const AZStd::string& sourceAssetPath, uint32_t expectedCount)
     {
-        auto operation = [sourceAssetPath, expectedCount]()
+        auto operation = [&sourceAssetPath = InternString(sourceAssetPath), expectedCount]()
         {
             GetInstance()->m_assetStatusTracker.ExpectAsset(sourceAssetPath, expectedCount);
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_AssetTracking_IdleUntilExpectedAssetsFinish(float timeout)
@@ -2159,7 +2653,7 @@ namespace AtomSampleViewer
             GetInstance()->m_assetTrackingTimeout = timeout;
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 
     void ScriptManager::Script_AssetTracking_Stop()
@@ -2169,6 +2663,6 @@ namespace AtomSampleViewer
             GetInstance()->m_assetStatusTracker.StopTracking();
         };
 
-        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+        PushScriptOperation(__func__, AZStd::move(operation));
     }
 } // namespace AtomSampleViewer
@@ -15,10 +15,14 @@
 #include <Automation/ScriptRepeaterBus.h>
 #include <Automation/ScriptRunnerBus.h>
 #include <Automation/AssetStatusTracker.h>
+#include <Automation/FrameTimingRecorder.h>
+#include <Automation/ScriptOperationQueue.h>
 #include <Automation/ScriptReporter.h>
 #include <Automation/ImageComparisonConfig.h>
+#include <Utils/CameraPath.h>
 #include <Utils/ImGuiAssetBrowser.h>
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/std/containers/array.h>
 
 namespace AZ
 {
@@ -67,7 +71,7 @@ namespace AtomSampleViewer
         void OpenScriptRunnerDialog();
         void OpenPrecommitWizard();
 
-        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed);
+        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, int shardIndex, int shardCount);
 
         static ScriptManager* GetInstance();
 
@@ -102,6 +106,13 @@ namespace AtomSampleViewer
         static void Script_Print(const AZStd::string& message);
         static void Script_IdleFrames(int numFrames);
         static void Script_IdleSeconds(float numSeconds);
+
+        // Idles until the scene has settled, instead of for a fixed number of frames. That is when all of these are true:
+        //  - The coefficient of variation (standard deviation / mean) of the last StableFrameWindow CPU frame times is at most maxVariation.
+        //  - The asset manager has no load jobs or streamer requests in flight, which includes image mips and shader variants.
+        //  - The Asset Processor has finished every job it started since AssetTracking_Start(), if asset tracking is on.
+        // The script continues with a warning if that doesn't happen before the timeout, in seconds.
+        static void Script_IdleUntilStable(float maxVariation, float timeout);
         static void Script_LockFrameTime(float seconds);
         static void Script_UnlockFrameTime();
         static void Script_ResizeViewport(int width, int height);
@@ -116,6 +127,9 @@ namespace AtomSampleViewer
         static float Script_DegToRad(float degrees);
         static AZStd::string Script_GetRenderApiName();
         static int Script_GetRandomTestSeed();
+        // The part of the test suite this process runs, from 0 to GetTestShardCount() - 1
+        static int Script_GetTestShardIndex();
+        static int Script_GetTestShardCount();
 
         // Samples...
         static void Script_OpenSample(const AZStd::string& sampleName);
@@ -162,10 +176,33 @@ namespace AtomSampleViewer
         // Profiling statistics data...
         static void Script_CapturePassTimestamp(AZ::ScriptDataContext& dc);
         static void Script_CaptureCpuFrameTime(AZ::ScriptDataContext& dc);
+
+        // Batched versions of CapturePassTimestamp and CaptureCpuFrameTime. These record the next frameCount frames into memory
+        // and write a single columnar file when done, without pausing the script on each frame.
+        // Captures started back to back record the same frames; the script continues once they have all finished.
+        static void Script_CapturePassTimestamps(int frameCount, const AZStd::string& outputFilePath);
+        static void Script_CaptureCpuFrameTimes(int frameCount, const AZStd::string& outputFilePath);
         static void Script_CapturePassPipelineStatistics(AZ::ScriptDataContext& dc);
         static void Script_CaptureCpuProfilingStatistics(AZ::ScriptDataContext& dc);
         static void Script_CaptureBenchmarkMetadata(AZ::ScriptDataContext& dc);
 
+        // Opens a sample and measures how its CPU frame time scales with one of its ScriptableImGui parameters.
+        // For each value, the parameter is set and the script idles until the frame time is stable, see IdleUntilStable(),
+        // before recording frameCount frames.
+        // The frame time statistics of all the values are written as the rows of a single CSV file.
+        // Arguments: sample name, parameter name, table of values, frame count, an optional output file path, which
+        // defaults to "@user@/scripts/PerformanceBenchmarks/<sample>/sweep_<parameter>.csv", and an optional table of setup fields.
+        // The setup fields are ScriptableImGui buttons or checkboxes that are set to true once the sample is open, before the sweep,
+        // for samples that need a click before the parameter's control is drawn.
+        // Example: SweepBenchmark('Performance/100KDrawable_SingleView', '##LatticeWidth', {5, 10, 20, 40}, 100, {'Reveal Sidebar'})
+        static void Script_SweepBenchmark(AZ::ScriptDataContext& dc);
+
+        // Measures how fast the AssetStatusTracker takes asset status events from several threads and applies them.
+        // See AssetStatusTracker::RunBenchmark(). A queue capacity smaller than the event count exercises the overflow path.
+        // The timings are printed to the log.
+        // Example: BenchmarkAssetStatusTracker(100000, 8, 1024)
+        static void Script_BenchmarkAssetStatusTracker(int eventCount, int threadCount, int eventQueueCapacity);
+
         // Camera...
         static void Script_ArcBallCameraController_SetCenter(AZ::Vector3 center);
         static void Script_ArcBallCameraController_SetPan(AZ::Vector3 pan);
@@ -177,6 +214,11 @@ namespace AtomSampleViewer
         static void Script_NoClipCameraController_SetPitch(float pitch);
         static void Script_NoClipCameraController_SetFov(float fov);
 
+        // Plays a camera path asset on the NoClip camera controller, advancing one frame of the path per rendered frame.
+        // The script waits until the path finishes. Captures started just before in the same frame record the whole path.
+        // @param productPath the camera path asset, e.g. "config/camerapaths/sponza_interior.camerapath.azasset"
+        static void Script_PlayCameraPath(const AZStd::string& productPath);
+
         // Asset System...
 
         // Starts tracking asset status updates from the Asset Processor. Clears any asset status information already collected.
@@ -201,6 +243,15 @@ namespace AtomSampleViewer
         static void CheckArcBallControllerHandler();
         static void CheckNoClipControllerHandler();
 
+        void StartWaitForStableFrames(float maxVariation, float timeout);
+
+        //! Records the last frame time and returns true once the wait started by StartWaitForStableFrames() is over
+        bool TickWaitForStableFrames(float deltaTime);
+
+        bool IsPlayingCameraPath() const { return m_cameraPathFrame < m_cameraPathFrameCount; }
+        void TickCameraPath();
+        void ApplyCameraPathFrame();
+
         // Similar to Script_Error, but reports the message immediately
         static void ReportScriptError(const AZStd::string& message);
 
@@ -254,12 +305,18 @@ namespace AtomSampleViewer
             bool m_closeOnTestScriptFinish = false;
             AZStd::string m_testSuitePath;
             int m_randomSeed = 0; // Used to shuffle test order in a random manner
+            int m_shardIndex = 0; // Used to split the test suite between processes
+            int m_shardCount = 1;
         };
 
         TestSuiteExecutionConfig m_testSuiteRunConfig;
 
         static constexpr float DefaultPauseTimeout = 5.0f;
 
+        static constexpr uint32_t StableFrameWindow = 30;
+        static constexpr float DefaultStableFrameTimeVariation = 0.05f;
+        static constexpr float DefaultStableTimeout = 30.0f;
+
         int m_scriptIdleFrames = 0;
         float m_scriptIdleSeconds = 0.0f;
         bool m_scriptPaused = false;
@@ -269,6 +326,20 @@ namespace AtomSampleViewer
         float m_assetTrackingTimeout = 0.0f;
         AssetStatusTracker m_assetStatusTracker;
 
+        bool m_waitForStableFrames = false;
+        float m_stableFramesTimeout = 0.0f;
+        float m_maxStableFrameTimeVariation = 0.0f;
+        AZStd::array<double, StableFrameWindow> m_stableFrameTimesMs; //< Ring buffer of the latest frame times
+        uint32_t m_stableFrameCount = 0;
+        bool m_skipStableFrame = false; //< The first frame time after the wait starts is of the frame that started it, before any change
+
+        FrameTimingRecorder m_frameTimingRecorder;
+
+        CameraPath m_cameraPath; //< The path started by PlayCameraPath()
+        AZ::u64 m_cameraPathFrame = 0;
+        AZ::u64 m_cameraPathFrameCount = 0;
+        bool m_cameraPathStartedThisFrame = false;
+
         AZStd::unique_ptr<AZ::ScriptContext> m_scriptContext; //< Provides the lua scripting system
         AZStd::unique_ptr<AZ::BehaviorContext> m_sriptBehaviorContext; //< Used to bind script callback functions to lua
 
@@ -280,8 +351,16 @@ namespace AtomSampleViewer
 
         ImGuiMessageBox m_messageBox;
 
-        using ScriptOp = AZStd::function<void()>;
-        AZStd::queue<ScriptOp> m_scriptOperations;
+        //! Queues an operation for TickScript(). The name must be a string literal or __func__, and loses its "Script_" prefix.
+        template<typename OperationT>
+        static void PushScriptOperation(const char* name, OperationT&& operation);
+
+        //! Returns a copy of the string owned by m_scriptOperations, for operations to capture by reference instead of copying.
+        static const AZStd::string& InternString(AZStd::string_view text);
+
+        ScriptOperationQueue m_scriptOperations;
+        size_t m_scriptOperationAllocationsAtStart = 0; //< Allocation count of m_scriptOperations when the current run started
+        size_t m_scriptOperationExecutionAllocationsAtStart = 0; //< Allocations m_scriptOperations made running operations before the current run
         bool m_doFinalScriptCleanup = false;
 
         ImGuiAssetBrowser m_scriptBrowser;
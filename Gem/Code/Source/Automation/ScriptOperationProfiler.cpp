@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/ScriptOperationProfiler.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <imgui/imgui.h>
+
+namespace AtomSampleViewer
+{
+    namespace
+    {
+        constexpr int ScriptsThreadId = 1;
+        constexpr int OperationsThreadId = 2;
+
+        void AppendJsonString(AZStd::string& json, AZStd::string_view text)
+        {
+            json += '"';
+            for (char c : text)
+            {
+                switch (c)
+                {
+                case '"': json += "\\\""; break;
+                case '\\': json += "\\\\"; break;
+                case '\n': json += "\\n"; break;
+                case '\r': json += "\\r"; break;
+                case '\t': json += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        json += AZStd::string::format("\\u%04x", c);
+                    }
+                    else
+                    {
+                        json += c;
+                    }
+                }
+            }
+            json += '"';
+        }
+
+        void AppendCompleteEvent(AZStd::string& json, AZStd::string_view name, int threadId, double startSeconds, double durationSeconds)
+        {
+            json += "        { \"name\": ";
+            AppendJsonString(json, name);
+            json += AZStd::string::format(", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f",
+                threadId, startSeconds * 1000000.0, durationSeconds * 1000000.0);
+        }
+    }
+
+    void ScriptOperationProfiler::Reset()
+    {
+        m_resetTime = Clock::now();
+        m_frameIndex = 0;
+        m_currentOperation = nullptr;
+        m_scripts.clear();
+        m_scriptIndexStack.clear();
+        m_scriptStartFrameStack.clear();
+        m_operationSpans.clear();
+        m_oldestOperationSpan = 0;
+        m_droppedOperationSpanCount = 0;
+        m_operationStats.clear();
+    }
+
+    void ScriptOperationProfiler::Tick()
+    {
+        ++m_frameIndex;
+    }
+
+    double ScriptOperationProfiler::GetSecondsSinceReset(Clock::time_point time) const
+    {
+        return AZStd::chrono::duration<double>(time - m_resetTime).count();
+    }
+
+    const ScriptOperationProfiler::OperationSpan& ScriptOperationProfiler::GetOperationSpan(size_t index) const
+    {
+        return m_operationSpans[(m_oldestOperationSpan + index) % m_operationSpans.size()];
+    }
+
+    void ScriptOperationProfiler::BeginOperation(const char* name)
+    {
+        EndOperation();
+
+        m_currentOperation = name;
+        m_currentOperationScriptIndex = m_scriptIndexStack.empty() ? m_scripts.size() : m_scriptIndexStack.back();
+        m_currentOperationStartTime = Clock::now();
+        m_currentOperationStartFrame = m_frameIndex;
+
+        if (!m_scriptIndexStack.empty())
+        {
+            ++m_scripts[m_scriptIndexStack.back()].m_operationCount;
+        }
+    }
+
+    void ScriptOperationProfiler::EndOperation()
+    {
+        if (!m_currentOperation)
+        {
+            return;
+        }
+
+        if (m_operationSpans.capacity() < MaxOperationSpanCount)
+        {
+            m_operationSpans.reserve(MaxOperationSpanCount);
+        }
+
+        OperationSpan* spanSlot = nullptr;
+        if (m_operationSpans.size() < MaxOperationSpanCount)
+        {
+            spanSlot = &m_operationSpans.emplace_back();
+        }
+        else
+        {
+            // Overwrite the oldest span
+            spanSlot = &m_operationSpans[m_oldestOperationSpan];
+            m_oldestOperationSpan = (m_oldestOperationSpan + 1) % MaxOperationSpanCount;
+            ++m_droppedOperationSpanCount;
+        }
+
+        OperationSpan& span = *spanSlot;
+        span.m_name = m_currentOperation;
+        span.m_scriptIndex = m_currentOperationScriptIndex;
+        span.m_startSeconds = GetSecondsSinceReset(m_currentOperationStartTime);
+        span.m_durationSeconds = AZStd::chrono::duration<double>(Clock::now() - m_currentOperationStartTime).count();
+        span.m_frameCount = m_frameIndex - m_currentOperationStartFrame;
+
+        OperationStats& stats = m_operationStats[m_currentOperation];
+        stats.m_name = m_currentOperation;
+        ++stats.m_count;
+        stats.m_frameCount += span.m_frameCount;
+        stats.m_totalSeconds += span.m_durationSeconds;
+        stats.m_maxSeconds = AZStd::max(stats.m_maxSeconds, span.m_durationSeconds);
+
+        m_currentOperation = nullptr;
+    }
+
+    void ScriptOperationProfiler::BeginScript(const AZStd::string& scriptAssetPath)
+    {
+        m_scriptIndexStack.push_back(m_scripts.size());
+        m_scriptStartFrameStack.push_back(m_frameIndex);
+
+        ScriptStats& script = m_scripts.emplace_back();
+        script.m_scriptAssetPath = scriptAssetPath;
+        script.m_startSeconds = GetSecondsSinceReset(Clock::now());
+        script.m_depth = m_scriptIndexStack.size() - 1;
+    }
+
+    void ScriptOperationProfiler::EndScript()
+    {
+        if (m_scriptIndexStack.empty())
+        {
+            return;
+        }
+
+        ScriptStats& script = m_scripts[m_scriptIndexStack.back()];
+        script.m_durationSeconds = GetSecondsSinceReset(Clock::now()) - script.m_startSeconds;
+        script.m_frameCount = m_frameIndex - m_scriptStartFrameStack.back();
+
+        m_scriptIndexStack.pop_back();
+        m_scriptStartFrameStack.pop_back();
+    }
+
+    AZStd::vector<ScriptOperationProfiler::OperationStats> ScriptOperationProfiler::GetOperationStats() const
+    {
+        AZStd::vector<OperationStats> operationStats;
+        operationStats.reserve(m_operationStats.size());
+        for (const auto& [name, stats] : m_operationStats)
+        {
+            // The same name can be a different string literal in different translation units
+            auto merged = AZStd::find_if(operationStats.begin(), operationStats.end(),
+                [name = AZStd::string_view(name)](const OperationStats& other) { return name == other.m_name; });
+            if (merged == operationStats.end())
+            {
+                operationStats.push_back(stats);
+            }
+            else
+            {
+                merged->m_count += stats.m_count;
+                merged->m_frameCount += stats.m_frameCount;
+                merged->m_totalSeconds += stats.m_totalSeconds;
+                merged->m_maxSeconds = AZStd::max(merged->m_maxSeconds, stats.m_maxSeconds);
+            }
+        }
+
+        AZStd::sort(operationStats.begin(), operationStats.end(),
+            [](const OperationStats& a, const OperationStats& b) { return a.m_totalSeconds > b.m_totalSeconds; });
+        return operationStats;
+    }
+
+    AZStd::vector<ScriptOperationProfiler::ScriptStats> ScriptOperationProfiler::GetScriptStats() const
+    {
+        AZStd::vector<ScriptStats> scriptStats;
+        scriptStats.reserve(m_scripts.size());
+        for (size_t i = 0; i < m_scripts.size(); ++i)
+        {
+            if (AZStd::find(m_scriptIndexStack.begin(), m_scriptIndexStack.end(), i) == m_scriptIndexStack.end())
+            {
+                scriptStats.push_back(m_scripts[i]);
+            }
+        }
+
+        AZStd::sort(scriptStats.begin(), scriptStats.end(),
+            [](const ScriptStats& a, const ScriptStats& b) { return a.m_durationSeconds > b.m_durationSeconds; });
+        return scriptStats;
+    }
+
+    bool ScriptOperationProfiler::ExportChromeTrace(const AZStd::string& outputFilePath) const
+    {
+        AZStd::string json = "{\n    \"displayTimeUnit\": \"ms\",\n    \"traceEvents\": [\n";
+        json += AZStd::string::format(
+            "        { \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, \"args\": { \"name\": \"Scripts\" } },\n", ScriptsThreadId);
+        json += AZStd::string::format(
+            "        { \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, \"args\": { \"name\": \"Operations\" } }", OperationsThreadId);
+
+        for (const ScriptStats& script : m_scripts)
+        {
+            json += ",\n";
+            AppendCompleteEvent(json, script.m_scriptAssetPath, ScriptsThreadId, script.m_startSeconds, script.m_durationSeconds);
+            json += AZStd::string::format(", \"args\": { \"frames\": %llu, \"operations\": %llu } }",
+                static_cast<unsigned long long>(script.m_frameCount), static_cast<unsigned long long>(script.m_operationCount));
+        }
+
+        AZ_Warning("ScriptOperationProfiler", m_droppedOperationSpanCount == 0,
+            "The trace only has the last %zu operations. %llu earlier operations were dropped.",
+            m_operationSpans.size(), static_cast<unsigned long long>(m_droppedOperationSpanCount));
+
+        for (size_t i = 0; i < m_operationSpans.size(); ++i)
+        {
+            const OperationSpan& span = GetOperationSpan(i);
+            json += ",\n";
+            AppendCompleteEvent(json, span.m_name, OperationsThreadId, span.m_startSeconds, span.m_durationSeconds);
+            json += AZStd::string::format(", \"args\": { \"frames\": %llu, \"script\": ", static_cast<unsigned long long>(span.m_frameCount));
+            AppendJsonString(json, span.m_scriptIndex < m_scripts.size() ? m_scripts[span.m_scriptIndex].m_scriptAssetPath : AZStd::string());
+            json += " } }";
+        }
+
+        json += "\n    ]\n}\n";
+
+        auto writeOutcome = AZ::Utils::WriteFile(json, outputFilePath);
+        AZ_Error("ScriptOperationProfiler", writeOutcome.IsSuccess(), "Failed to write '%s'.", outputFilePath.c_str());
+        return writeOutcome.IsSuccess();
+    }
+
+    void ScriptOperationProfiler::DrawImGui(size_t rowCount) const
+    {
+        const AZStd::vector<ScriptStats> scriptStats = GetScriptStats();
+        const AZStd::vector<OperationStats> operationStats = GetOperationStats();
+
+        ImGui::Text("Slowest Scripts");
+        ImGui::Columns(4, "SlowestScripts");
+        ImGui::Text("Script");
+        ImGui::NextColumn();
+        ImGui::Text("Time");
+        ImGui::NextColumn();
+        ImGui::Text("Frames");
+        ImGui::NextColumn();
+        ImGui::Text("Operations");
+        ImGui::NextColumn();
+        ImGui::Separator();
+
+        for (size_t i = 0; i < AZStd::min(rowCount, scriptStats.size()); ++i)
+        {
+            const ScriptStats& script = scriptStats[i];
+            ImGui::Text("%s", script.m_scriptAssetPath.c_str());
+            ImGui::NextColumn();
+            ImGui::Text("%.2f s", script.m_durationSeconds);
+            ImGui::NextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(script.m_frameCount));
+            ImGui::NextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(script.m_operationCount));
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+
+        ImGui::Separator();
+
+        ImGui::Text("Slowest Operations");
+        ImGui::Columns(5, "SlowestOperations");
+        ImGui::Text("Operation");
+        ImGui::NextColumn();
+        ImGui::Text("Total Time");
+        ImGui::NextColumn();
+        ImGui::Text("Count");
+        ImGui::NextColumn();
+        ImGui::Text("Max Time");
+        ImGui::NextColumn();
+        ImGui::Text("Frames");
+        ImGui::NextColumn();
+        ImGui::Separator();
+
+        for (size_t i = 0; i < AZStd::min(rowCount, operationStats.size()); ++i)
+        {
+            const OperationStats& operation = operationStats[i];
+            ImGui::Text("%s", operation.m_name);
+            ImGui::NextColumn();
+            ImGui::Text("%.2f s", operation.m_totalSeconds);
+            ImGui::NextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(operation.m_count));
+            ImGui::NextColumn();
+            ImGui::Text("%.2f s", operation.m_maxSeconds);
+            ImGui::NextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(operation.m_frameCount));
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Measures where the time of a script run goes, by script and by type of script operation.
+    //! An operation's span starts when the ScriptManager executes it and ends when the next operation executes,
+    //! so it includes the frames the script waited because of it (idle frames, asset tracking, screenshot checks, etc.)
+    //! The profile can be saved as a Chrome trace, to be opened in chrome://tracing or https://ui.perfetto.dev
+    class ScriptOperationProfiler final
+    {
+    public:
+        struct OperationStats
+        {
+            const char* m_name = nullptr;
+            AZ::u64 m_count = 0;
+            AZ::u64 m_frameCount = 0;
+            double m_totalSeconds = 0.0;
+            double m_maxSeconds = 0.0;
+        };
+
+        struct ScriptStats
+        {
+            AZStd::string m_scriptAssetPath;
+            AZ::u64 m_operationCount = 0;
+            AZ::u64 m_frameCount = 0;
+            double m_startSeconds = 0.0;    //!< Since the profile was reset
+            double m_durationSeconds = 0.0; //!< Includes any scripts it ran
+            size_t m_depth = 0;             //!< The number of scripts that were running when this one started
+        };
+
+        //! The number of rows in each table of DrawImGui()
+        static constexpr size_t DefaultTableRowCount = 10;
+
+        //! The trace keeps the most recent operation spans, so long runs don't grow the profile without bound
+        static constexpr size_t MaxOperationSpanCount = 32 * 1024;
+
+        //! Clears the profile. Times in the trace are relative to the last reset.
+        void Reset();
+
+        //! Counts frames. Must be called once per frame.
+        void Tick();
+
+        //! Ends the current operation and starts the next one. The name must outlive the profiler, like a string literal.
+        void BeginOperation(const char* name);
+
+        //! Ends the current operation, when there is no other operation to execute.
+        void EndOperation();
+
+        void BeginScript(const AZStd::string& scriptAssetPath);
+        void EndScript();
+
+        //! Returns the stats of each type of operation, sorted by total time.
+        AZStd::vector<OperationStats> GetOperationStats() const;
+
+        //! Returns the stats of each script that finished, sorted by duration.
+        AZStd::vector<ScriptStats> GetScriptStats() const;
+
+        //! Writes every script and the most recent operation spans in the Chrome trace event format.
+        bool ExportChromeTrace(const AZStd::string& outputFilePath) const;
+
+        //! Draws tables of the slowest scripts and operations.
+        void DrawImGui(size_t rowCount = DefaultTableRowCount) const;
+
+    private:
+        using Clock = AZStd::chrono::steady_clock;
+
+        //! A completed operation span, for the trace
+        struct OperationSpan
+        {
+            const char* m_name = nullptr;
+            size_t m_scriptIndex = 0;  //!< Index in m_scripts, or m_scripts.size() if no script was running
+            double m_startSeconds = 0.0;
+            double m_durationSeconds = 0.0;
+            AZ::u64 m_frameCount = 0;
+        };
+
+        double GetSecondsSinceReset(Clock::time_point time) const;
+
+        //! Returns the span that was recorded index spans after the oldest one that is kept.
+        const OperationSpan& GetOperationSpan(size_t index) const;
+
+        Clock::time_point m_resetTime = Clock::now();
+        AZ::u64 m_frameIndex = 0;
+
+        const char* m_currentOperation = nullptr;
+        size_t m_currentOperationScriptIndex = 0;
+        Clock::time_point m_currentOperationStartTime;
+        AZ::u64 m_currentOperationStartFrame = 0;
+
+        AZStd::vector<ScriptStats> m_scripts;
+        AZStd::vector<size_t> m_scriptIndexStack;           //!< Scripts in m_scripts that are running
+        AZStd::vector<AZ::u64> m_scriptStartFrameStack;
+
+        AZStd::vector<OperationSpan> m_operationSpans;      //!< Ring buffer of MaxOperationSpanCount spans, once it is full
+        size_t m_oldestOperationSpan = 0;
+        AZ::u64 m_droppedOperationSpanCount = 0;
+
+        //! Keyed by the name pointer, so recording an operation doesn't build a string. GetOperationStats() merges the
+        //! stats of equal names at different addresses.
+        AZStd::unordered_map<const char*, OperationStats> m_operationStats;
+    };
+} // namespace AtomSampleViewer
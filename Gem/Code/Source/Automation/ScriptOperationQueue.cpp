@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/ScriptOperationQueue.h>
+
+namespace AtomSampleViewer
+{
+    ScriptOperationQueue::~ScriptOperationQueue()
+    {
+        Clear();
+    }
+
+    const char* ScriptOperationQueue::GetFrontName() const
+    {
+        AZ_Assert(m_count > 0, "The script operation queue is empty");
+        return m_records[m_head].m_name;
+    }
+
+    void ScriptOperationQueue::PopAndExecute()
+    {
+        AZ_Assert(m_count > 0, "The script operation queue is empty");
+
+        // Move the operation out of the buffer first, because it can push operations that grow the buffer while it runs
+        Record current;
+        Record& front = m_records[m_head];
+        current.m_name = front.m_name;
+        current.m_functions = front.m_functions;
+        front.m_functions->m_relocate(front.m_storage, current.m_storage);
+        front.m_functions = nullptr;
+
+        m_head = (m_head + 1) % m_records.size();
+        --m_count;
+
+        const size_t allocationCount = m_allocationCounters.m_allocationCount;
+        current.m_functions->m_execute(current.m_storage);
+        current.m_functions->m_destroy(current.m_storage, m_allocator);
+        m_executionAllocationCount += m_allocationCounters.m_allocationCount - allocationCount;
+    }
+
+    void ScriptOperationQueue::Clear()
+    {
+        while (m_count > 0)
+        {
+            Record& front = m_records[m_head];
+            front.m_functions->m_destroy(front.m_storage, m_allocator);
+            front.m_functions = nullptr;
+
+            m_head = (m_head + 1) % m_records.size();
+            --m_count;
+        }
+        m_head = 0;
+    }
+
+    const AZStd::string& ScriptOperationQueue::InternString(AZStd::string_view text)
+    {
+        auto iter = m_internedStringLookup.find(text);
+        if (iter != m_internedStringLookup.end())
+        {
+            return *iter->second;
+        }
+
+        const AZStd::string& internedString = m_internedStrings.emplace_back(text);
+        m_internedStringLookup.emplace(internedString, &internedString);
+
+        // Text that doesn't fit in the string object is stored in a buffer from the system allocator
+        const char* stringObject = reinterpret_cast<const char*>(&internedString);
+        if (internedString.data() < stringObject || internedString.data() >= stringObject + sizeof(AZStd::string))
+        {
+            ++m_allocationCounters.m_allocationCount;
+            m_allocationCounters.m_allocatedByteCount += internedString.capacity() + 1;
+        }
+
+        return internedString;
+    }
+
+    void ScriptOperationQueue::ResetInternedStrings()
+    {
+        if (!IsEmpty())
+        {
+            return;
+        }
+
+        m_internedStringLookup.clear();
+        m_internedStrings.clear();
+    }
+
+    ScriptOperationQueue::Record& ScriptOperationQueue::AllocateBack()
+    {
+        if (m_count == m_records.size())
+        {
+            Grow();
+        }
+
+        Record& record = m_records[(m_head + m_count) % m_records.size()];
+        ++m_count;
+        return record;
+    }
+
+    void ScriptOperationQueue::Grow()
+    {
+        AZStd::vector<Record, CountingAllocator> records(AZStd::max(InitialCapacity, m_records.size() * 2), Record(), m_allocator);
+
+        // Relocate the operations in order, so the new buffer starts at the head
+        for (size_t i = 0; i < m_count; ++i)
+        {
+            Record& from = m_records[(m_head + i) % m_records.size()];
+            Record& to = records[i];
+            to.m_name = from.m_name;
+            to.m_functions = from.m_functions;
+            from.m_functions->m_relocate(from.m_storage, to.m_storage);
+        }
+
+        m_records = AZStd::move(records);
+        m_head = 0;
+    }
+} // namespace AtomSampleViewer
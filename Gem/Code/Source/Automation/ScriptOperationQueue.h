@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/utils.h>
+#include <new>
+
+namespace AtomSampleViewer
+{
+    //! FIFO of the operations queued by scripts, for the ScriptManager to run in TickScript().
+    //! Operations are stored in a ring buffer of fixed-size records, with the callable constructed in place in the record.
+    //! The buffer only grows, so once it has held the most operations a script queues at once, queuing and running
+    //! operations doesn't allocate. Operations that capture strings should capture references to InternString() instead,
+    //! which only allocates the first time it sees a string.
+    //! The queue's storage goes through a counting allocator, so the counts only include the queue's own allocations and
+    //! GetExecutionAllocationCount() can check that running the operations of a long script doesn't allocate.
+    class ScriptOperationQueue final
+    {
+    public:
+        //! Callables larger than this are allocated on the heap
+        static constexpr size_t InlineStorageSize = 96;
+        static constexpr size_t InlineStorageAlignment = 16;
+        static constexpr size_t InitialCapacity = 256;
+
+        ScriptOperationQueue() = default;
+        ~ScriptOperationQueue();
+
+        ScriptOperationQueue(const ScriptOperationQueue&) = delete;
+        ScriptOperationQueue& operator=(const ScriptOperationQueue&) = delete;
+
+        bool IsEmpty() const { return m_count == 0; }
+        size_t GetSize() const { return m_count; }
+
+        //! Queues an operation. The name must outlive the queue, like a string literal.
+        template<typename OperationT>
+        void Push(const char* name, OperationT&& operation);
+
+        //! Returns the name of the next operation.
+        const char* GetFrontName() const;
+
+        //! Removes the next operation and runs it. The operation can queue more operations.
+        void PopAndExecute();
+
+        //! Removes every operation without running them. Keeps the storage for the next script.
+        void Clear();
+
+        //! Returns a copy of the string that stays valid until ResetInternedStrings() is called.
+        const AZStd::string& InternString(AZStd::string_view text);
+
+        //! Releases the interned strings, so the table doesn't keep growing from run to run.
+        //! Queued operations can reference them, so this does nothing unless the queue is empty.
+        void ResetInternedStrings();
+
+        //! The number of allocations, and their total size, that the queue has made for its records, heap-stored operations
+        //! and interned strings. The totals only increase.
+        size_t GetAllocationCount() const { return m_allocationCounters.m_allocationCount; }
+        size_t GetAllocatedByteCount() const { return m_allocationCounters.m_allocatedByteCount; }
+
+        //! The part of GetAllocationCount() made while an operation was running in PopAndExecute().
+        //! Allocations the operations make in other systems aren't included.
+        size_t GetExecutionAllocationCount() const { return m_executionAllocationCount; }
+
+    private:
+        struct AllocationCounters
+        {
+            size_t m_allocationCount = 0;
+            size_t m_allocatedByteCount = 0;
+        };
+
+        //! Allocator of the queue's containers that counts the allocations. Unlike samples of the shared system allocator,
+        //! the counts don't include the allocations of other threads.
+        class CountingAllocator
+            : public AZStd::allocator
+        {
+        public:
+            explicit CountingAllocator(AllocationCounters* counters)
+                : m_counters(counters)
+            {
+            }
+
+            void* allocate(size_t byteSize, size_t alignment, int flags = 0)
+            {
+                AZ_UNUSED(flags);
+                ++m_counters->m_allocationCount;
+                m_counters->m_allocatedByteCount += byteSize;
+                return AZStd::allocator::allocate(byteSize, alignment);
+            }
+
+            //! Growing a block in place would bypass allocate(), so the containers always allocate a new block
+            size_t resize(void* ptr, size_t newSize)
+            {
+                AZ_UNUSED(ptr);
+                AZ_UNUSED(newSize);
+                return 0;
+            }
+
+            friend bool operator==(const CountingAllocator& a, const CountingAllocator& b) { return a.m_counters == b.m_counters; }
+            friend bool operator!=(const CountingAllocator& a, const CountingAllocator& b) { return a.m_counters != b.m_counters; }
+
+        private:
+            AllocationCounters* m_counters = nullptr;
+        };
+
+        //! Type-erased functions of a callable type
+        struct OperationFunctions
+        {
+            void (*m_execute)(void* storage);
+            void (*m_destroy)(void* storage, CountingAllocator& allocator);
+            void (*m_relocate)(void* from, void* to); //!< Moves the callable to uninitialized storage and destroys the source
+        };
+
+        struct Record
+        {
+            const char* m_name = nullptr;
+            const OperationFunctions* m_functions = nullptr;
+            alignas(InlineStorageAlignment) unsigned char m_storage[InlineStorageSize];
+        };
+
+        template<typename OperationT>
+        static constexpr bool IsStoredInline = sizeof(OperationT) <= InlineStorageSize && alignof(OperationT) <= InlineStorageAlignment;
+
+        template<typename OperationT>
+        static const OperationFunctions* GetOperationFunctions();
+
+        //! Returns the record at the back of the queue, after making room for it.
+        Record& AllocateBack();
+        void Grow();
+
+        // Declared first, so the containers can be given the allocator and are destroyed before it
+        AllocationCounters m_allocationCounters;
+        CountingAllocator m_allocator{ &m_allocationCounters };
+        size_t m_executionAllocationCount = 0;
+
+        AZStd::vector<Record, CountingAllocator> m_records{ m_allocator };
+        size_t m_head = 0;
+        size_t m_count = 0;
+
+        //! Elements don't move when more are added. The string buffers come from the system allocator and are counted in InternString().
+        AZStd::deque<AZStd::string, CountingAllocator> m_internedStrings{ m_allocator };
+        AZStd::unordered_map<AZStd::string_view, const AZStd::string*, AZStd::hash<AZStd::string_view>, AZStd::equal_to<AZStd::string_view>, CountingAllocator>
+            m_internedStringLookup{ m_allocator };
+    };
+
+    template<typename OperationT>
+    const ScriptOperationQueue::OperationFunctions* ScriptOperationQueue::GetOperationFunctions()
+    {
+        if constexpr (IsStoredInline<OperationT>)
+        {
+            static const OperationFunctions functions = {
+                [](void* storage) { (*static_cast<OperationT*>(storage))(); },
+                [](void* storage, CountingAllocator&) { static_cast<OperationT*>(storage)->~OperationT(); },
+                [](void* from, void* to)
+                {
+                    new (to) OperationT(AZStd::move(*static_cast<OperationT*>(from)));
+                    static_cast<OperationT*>(from)->~OperationT();
+                }
+            };
+            return &functions;
+        }
+        else
+        {
+            // The storage holds a pointer to the operation
+            static const OperationFunctions functions = {
+                [](void* storage) { (**static_cast<OperationT**>(storage))(); },
+                [](void* storage, CountingAllocator& allocator)
+                {
+                    OperationT* operation = *static_cast<OperationT**>(storage);
+                    operation->~OperationT();
+                    allocator.deallocate(operation, sizeof(OperationT), alignof(OperationT));
+                },
+                [](void* from, void* to) { *static_cast<OperationT**>(to) = *static_cast<OperationT**>(from); }
+            };
+            return &functions;
+        }
+    }
+
+    template<typename OperationT>
+    void ScriptOperationQueue::Push(const char* name, OperationT&& operation)
+    {
+        using StoredT = AZStd::decay_t<OperationT>;
+
+        Record& record = AllocateBack();
+        record.m_name = name;
+        record.m_functions = GetOperationFunctions<StoredT>();
+
+        if constexpr (IsStoredInline<StoredT>)
+        {
+            new (record.m_storage) StoredT(AZStd::forward<OperationT>(operation));
+        }
+        else
+        {
+            void* memory = m_allocator.allocate(sizeof(StoredT), alignof(StoredT));
+            *reinterpret_cast<StoredT**>(record.m_storage) = new (memory) StoredT(AZStd::forward<OperationT>(operation));
+        }
+    }
+} // namespace AtomSampleViewer
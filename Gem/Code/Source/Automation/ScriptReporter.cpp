@@ -8,12 +8,18 @@
 
 #include <sstream>
 #include <Automation/ScriptReporter.h>
+#include <Automation/ImageDiff.h>
+#include <Automation/ScreenshotComparison.h>
 #include <Utils/Utils.h>
 #include <Atom/RHI/Factory.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzFramework/IO/LocalFileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Utils/Utils.h>
 
 namespace AtomSampleViewer
@@ -76,15 +82,110 @@ namespace AtomSampleViewer
         m_availableToleranceLevels = toleranceLevels;
     }
 
+    void ScriptReporter::Reflect(AZ::ReflectContext* context)
+    {
+        ExportedTestResults::Screenshot::Reflect(context);
+        ExportedTestResults::Script::Reflect(context);
+        ExportedTestResults::Reflect(context);
+    }
+
+    void ScriptReporter::ExportedTestResults::Screenshot::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<ScriptReporter::ExportedTestResults::Screenshot>()
+                ->Version(0)
+                ->Field("ScreenshotFilePath", &ScriptReporter::ExportedTestResults::Screenshot::m_screenshotFilePath)
+                ->Field("OfficialBaselineFilePath", &ScriptReporter::ExportedTestResults::Screenshot::m_officialBaselineScreenshotFilePath)
+                ->Field("ToleranceLevel", &ScriptReporter::ExportedTestResults::Screenshot::m_toleranceLevel)
+                ->Field("Result", &ScriptReporter::ExportedTestResults::Screenshot::m_result)
+                ->Field("Passed", &ScriptReporter::ExportedTestResults::Screenshot::m_passed)
+                ;
+        }
+    }
+
+    void ScriptReporter::ExportedTestResults::Script::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<ScriptReporter::ExportedTestResults::Script>()
+                ->Version(0)
+                ->Field("ScriptAssetPath", &ScriptReporter::ExportedTestResults::Script::m_scriptAssetPath)
+                ->Field("DurationSeconds", &ScriptReporter::ExportedTestResults::Script::m_durationSeconds)
+                ->Field("Asserts", &ScriptReporter::ExportedTestResults::Script::m_assertCount)
+                ->Field("Errors", &ScriptReporter::ExportedTestResults::Script::m_generalErrorCount)
+                ->Field("ScreenshotErrors", &ScriptReporter::ExportedTestResults::Script::m_screenshotErrorCount)
+                ->Field("Warnings", &ScriptReporter::ExportedTestResults::Script::m_generalWarningCount)
+                ->Field("ScreenshotWarnings", &ScriptReporter::ExportedTestResults::Script::m_screenshotWarningCount)
+                ->Field("Screenshots", &ScriptReporter::ExportedTestResults::Script::m_screenshots)
+                ;
+        }
+    }
+
+    void ScriptReporter::ExportedTestResults::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<ScriptReporter::ExportedTestResults>()
+                ->Version(0)
+                ->Field("ShardIndex", &ScriptReporter::ExportedTestResults::m_shardIndex)
+                ->Field("ShardCount", &ScriptReporter::ExportedTestResults::m_shardCount)
+                ->Field("Scripts", &ScriptReporter::ExportedTestResults::m_scripts)
+                ;
+        }
+    }
+
+    ScriptReporter::~ScriptReporter()
+    {
+        // The comparison jobs write into the pending checks, so they must finish before those are destroyed.
+        for (auto& [reportIndex, check] : m_pendingScreenshotChecks)
+        {
+            check->m_completion.StartAndWaitForCompletion();
+        }
+    }
+
     void ScriptReporter::Reset()
     {
+        // Results of comparisons from a previous run are discarded along with the reports they belong to.
+        for (auto& [reportIndex, check] : m_pendingScreenshotChecks)
+        {
+            check->m_completion.StartAndWaitForCompletion();
+        }
+        m_pendingScreenshotChecks.clear();
+
         m_scriptReports.clear();
         m_reportsSortedByOfficialBaslineScore.clear();
         m_reportsSortedByLocaBaslineScore.clear();
         m_currentScriptIndexStack.clear();
         m_invalidationMessage.clear();
         m_uniqueTimestamp = GenerateTimestamp();
+        m_operationProfiler.Reset();
+
+        ConfigureBaselineImageCache();
+    }
+
+    void ScriptReporter::ConfigureBaselineImageCache()
+    {
+        static constexpr AZStd::string_view MemoryBudgetKey = "/O3DE/AtomSampleViewer/BaselineImageCache/MemoryBudgetMB";
+        static constexpr AZStd::string_view PersistSidecarsKey = "/O3DE/AtomSampleViewer/BaselineImageCache/PersistSidecars";
+
+        AZ::u64 memoryBudgetMB = BaselineImageCache::DefaultMemoryBudget / (1024 * 1024);
+        bool persistSidecars = false;
+        if (auto registry = AZ::SettingsRegistry::Get())
+        {
+            registry->Get(memoryBudgetMB, MemoryBudgetKey);
+            registry->Get(persistSidecars, PersistSidecarsKey);
+        }
 
+        AZStd::string sidecarFolder;
+        if (persistSidecars)
+        {
+            AZ::IO::FixedMaxPath resolvedPath;
+            AZ::IO::LocalFileIO::GetInstance()->ResolvePath(resolvedPath, "@user@/ScreenshotBaselineCache");
+            sidecarFolder = resolvedPath.String();
+        }
+
+        m_baselineImageCache.Configure(static_cast<size_t>(memoryBudgetMB) * 1024 * 1024, sidecarFolder);
     }
 
     void ScriptReporter::SetInvalidationMessage(const AZStd::string& message)
@@ -105,17 +206,23 @@ namespace AtomSampleViewer
 
         m_currentScriptIndexStack.push_back(m_scriptReports.size());
         m_scriptReports.emplace_back().m_scriptAssetPath = scriptAssetPath;
+        m_scriptReports.back().m_startTime = AZStd::chrono::steady_clock::now();
         m_scriptReports.back().BusConnect();
+
+        m_operationProfiler.BeginScript(scriptAssetPath);
     }
 
     void ScriptReporter::PopScript()
     {
         AZ_Assert(GetCurrentScriptReport(), "There is no active script");
 
-        if (GetCurrentScriptReport())
+        if (ScriptReport* scriptReport = GetCurrentScriptReport())
         {
-            GetCurrentScriptReport()->BusDisconnect();
+            scriptReport->m_durationSeconds =
+                AZStd::chrono::duration<double>(AZStd::chrono::steady_clock::now() - scriptReport->m_startTime).count();
+            scriptReport->BusDisconnect();
             m_currentScriptIndexStack.pop_back();
+            m_operationProfiler.EndScript();
         }
 
         if (GetCurrentScriptReport())
@@ -397,6 +504,20 @@ namespace AtomSampleViewer
                     });
             }
 
+            if (ImGui::CollapsingHeader("Timing Profile"))
+            {
+                m_operationProfiler.DrawImGui();
+
+                if (ImGui::Button("Export Chrome Trace"))
+                {
+                    const AZStd::string traceFile = ExportScriptTrace(AZStd::string::format("scriptTrace_%s.json", m_uniqueTimestamp.c_str()));
+                    if (!traceFile.empty())
+                    {
+                        m_messageBox.OpenPopupMessage("Exported Chrome trace", AZStd::string::format("Trace exported to %s", traceFile.c_str()));
+                    }
+                }
+            }
+
             int displayOption = m_displayOption;
             ImGui::Combo("Display", &displayOption, DiplayOptions, AZ_ARRAY_SIZE(DiplayOptions));
             m_displayOption = (DisplayOption)displayOption;
@@ -1068,7 +1189,11 @@ namespace AtomSampleViewer
 
         auto io = AZ::IO::LocalFileIO::GetInstance();
         screenshotTestInfo.m_toleranceLevel = *toleranceLevel;
-        static constexpr float ImperceptibleDiffFilter = 0.01;
+
+        // Decoding and diffing the images is expensive, so the comparisons run on the job system while the script keeps going.
+        // Missing baselines are reported right away; everything else is reported when the job finishes.
+        AZStd::unique_ptr<PendingScreenshotCheck> check = AZStd::make_unique<PendingScreenshotCheck>();
+        check->m_screenshotFilePath = screenshotTestInfo.m_screenshotFilePath;
 
         if (screenshotTestInfo.m_officialBaselineScreenshotFilePath.empty()
             || !io->Exists(screenshotTestInfo.m_officialBaselineScreenshotFilePath.c_str()))
@@ -1078,26 +1203,143 @@ namespace AtomSampleViewer
         }
         else
         {
-            AZ::Render::FrameCaptureComparisonOutcome compOutcome;
-            AZ::Render::FrameCaptureTestRequestBus::BroadcastResult(
-                compOutcome,
-                &AZ::Render::FrameCaptureTestRequestBus::Events::CompareScreenshots,
-                screenshotTestInfo.m_screenshotFilePath,
-                screenshotTestInfo.m_officialBaselineScreenshotFilePath,
-                ImperceptibleDiffFilter
-            );
+            check->m_officialBaselineScreenshotFilePath = screenshotTestInfo.m_officialBaselineScreenshotFilePath;
+        }
+
+        if (screenshotTestInfo.m_localBaselineScreenshotFilePath.empty()
+            || !io->Exists(screenshotTestInfo.m_localBaselineScreenshotFilePath.c_str()))
+        {
+            ReportScriptWarning(AZStd::string::format("Screenshot check failed. Could not determine local baseline screenshot path for '%s'", screenshotTestInfo.m_screenshotFilePath.c_str()));
+            screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::FileNotFound;
+        }
+        else
+        {
+            check->m_localBaselineScreenshotFilePath = screenshotTestInfo.m_localBaselineScreenshotFilePath;
+        }
+
+        if (check->m_officialBaselineScreenshotFilePath.empty() && check->m_localBaselineScreenshotFilePath.empty())
+        {
+            return;
+        }
+
+        PendingScreenshotCheck* pendingCheck = check.get();
+        BaselineImageCache* baselineImageCache = &m_baselineImageCache;
+        AZ::Job* job = AZ::CreateJobFunction([pendingCheck, baselineImageCache]()
+            {
+                RunScreenshotCheck(*pendingCheck, *baselineImageCache);
+                pendingCheck->m_isFinished = true;
+            }, true);
+        job->SetDependent(&pendingCheck->m_completion);
+        job->Start();
+
+        const ReportIndex reportIndex{ m_currentScriptIndexStack.back(), GetCurrentScriptReport()->m_screenshotTests.size() - 1 };
+        m_pendingScreenshotChecks.emplace(reportIndex, AZStd::move(check));
+    }
+
+    void ScriptReporter::RunScreenshotCheck(PendingScreenshotCheck& check, BaselineImageCache& baselineImageCache)
+    {
+        ScreenshotComparison comparison(check.m_screenshotFilePath, baselineImageCache);
+
+        auto compare = [&comparison](const AZStd::string& baselineFilePath, BaselineComparison& baselineComparison)
+        {
+            if (baselineFilePath.empty())
+            {
+                return;
+            }
+
+            const ScreenshotComparison::Outcome outcome = comparison.CompareWithBaseline(baselineFilePath);
+            baselineComparison.m_scores = outcome.m_scores;
+
+            switch (outcome.m_result)
+            {
+            case ScreenshotComparison::Result::Compared:
+                baselineComparison.m_resultCode = ImageComparisonResult::ResultCode::Pass;
+                break;
+            case ScreenshotComparison::Result::FileNotFound:
+                baselineComparison.m_resultCode = ImageComparisonResult::ResultCode::FileNotFound;
+                break;
+            case ScreenshotComparison::Result::WrongFormat:
+                baselineComparison.m_resultCode = ImageComparisonResult::ResultCode::WrongFormat;
+                break;
+            case ScreenshotComparison::Result::WrongSize:
+                baselineComparison.m_resultCode = ImageComparisonResult::ResultCode::WrongSize;
+                break;
+            default:
+                baselineComparison.m_resultCode = ImageComparisonResult::ResultCode::FileNotLoaded;
+                break;
+            }
+        };
 
-            screenshotTestInfo.m_officialComparisonResult.m_diffScore = 0.0;
+        compare(check.m_officialBaselineScreenshotFilePath, check.m_officialComparison);
+        compare(check.m_localBaselineScreenshotFilePath, check.m_localComparison);
+    }
 
-            if (compOutcome.IsSuccess())
+    void ScriptReporter::ProcessCompletedScreenshotChecks()
+    {
+        for (auto iter = m_pendingScreenshotChecks.begin(); iter != m_pendingScreenshotChecks.end();)
+        {
+            PendingScreenshotCheck& check = *iter->second;
+            if (check.m_isFinished)
             {
-                screenshotTestInfo.m_officialComparisonResult.m_diffScore = toleranceLevel->m_filterImperceptibleDiffs
-                    ? compOutcome.GetValue().m_diffScore
-                    : compOutcome.GetValue().m_filteredDiffScore;
+                check.m_completion.StartAndWaitForCompletion();
+                FinishScreenshotCheck(iter->first, check);
+                iter = m_pendingScreenshotChecks.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
 
-                if (screenshotTestInfo.m_officialComparisonResult.m_diffScore <= toleranceLevel->m_threshold)
+    void ScriptReporter::WaitForScreenshotChecks()
+    {
+        for (auto& [reportIndex, check] : m_pendingScreenshotChecks)
+        {
+            check->m_completion.StartAndWaitForCompletion();
+            FinishScreenshotCheck(reportIndex, *check);
+        }
+        m_pendingScreenshotChecks.clear();
+    }
+
+    bool ScriptReporter::HasPendingScreenshotChecks() const
+    {
+        return !m_pendingScreenshotChecks.empty();
+    }
+
+    void ScriptReporter::FinishScreenshotCheck(const ReportIndex& reportIndex, PendingScreenshotCheck& check)
+    {
+        ScriptReport& scriptReport = m_scriptReports[reportIndex.first];
+        ScreenshotTestInfo& screenshotTestInfo = scriptReport.m_screenshotTests[reportIndex.second];
+        const ImageComparisonToleranceLevel& toleranceLevel = screenshotTestInfo.m_toleranceLevel;
+
+        // The script that requested this check may no longer be the current one. Temporarily make its report the one
+        // listening for Trace messages so the screenshot errors and warnings below are counted against the right script.
+        ScriptReport* currentScriptReport = GetCurrentScriptReport();
+        const bool swapTraceListener = currentScriptReport != &scriptReport;
+        if (swapTraceListener)
+        {
+            if (currentScriptReport)
+            {
+                currentScriptReport->BusDisconnect();
+            }
+            scriptReport.BusConnect();
+        }
+
+        if (!check.m_officialBaselineScreenshotFilePath.empty())
+        {
+            ImageComparisonResult& result = screenshotTestInfo.m_officialComparisonResult;
+            result.m_diffScore = 0.0;
+
+            if (check.m_officialComparison.m_resultCode == ImageComparisonResult::ResultCode::Pass)
+            {
+                result.m_diffScore = toleranceLevel.m_filterImperceptibleDiffs
+                    ? check.m_officialComparison.m_scores.m_diffScore
+                    : check.m_officialComparison.m_scores.m_filteredDiffScore;
+
+                if (result.m_diffScore <= toleranceLevel.m_threshold)
                 {
-                    screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Pass;
+                    result.m_resultCode = ImageComparisonResult::ResultCode::Pass;
                 }
                 else
                 {
@@ -1105,59 +1347,68 @@ namespace AtomSampleViewer
                     // If you change this message, be sure to update the associated tests as well located here: "C:/path/to/Lumberyard/AtomSampleViewer/Standalone/PythonTests"
                     ReportScreenshotComparisonIssue(
                         AZStd::string::format("Screenshot check failed. Diff score %f exceeds threshold of %f ('%s').",
-                            screenshotTestInfo.m_officialComparisonResult.m_diffScore, toleranceLevel->m_threshold, toleranceLevel->m_name.c_str()),
+                            result.m_diffScore, toleranceLevel.m_threshold, toleranceLevel.m_name.c_str()),
                         screenshotTestInfo.m_officialBaselineScreenshotFilePath,
                         screenshotTestInfo.m_screenshotFilePath,
                         TraceLevel::Error);
-                    screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
+                    result.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
                 }
             }
+            else
+            {
+                result.m_resultCode = check.m_officialComparison.m_resultCode;
+                ReportScriptError(AZStd::string::format("Screenshot check failed. Could not compare '%s' with '%s': %s.",
+                    screenshotTestInfo.m_screenshotFilePath.c_str(), screenshotTestInfo.m_officialBaselineScreenshotFilePath.c_str(), result.GetSummaryString().c_str()));
+            }
         }
 
-        if (screenshotTestInfo.m_localBaselineScreenshotFilePath.empty()
-            || !io->Exists(screenshotTestInfo.m_localBaselineScreenshotFilePath.c_str()))
-        {
-            ReportScriptWarning(AZStd::string::format("Screenshot check failed. Could not determine local baseline screenshot path for '%s'", screenshotTestInfo.m_screenshotFilePath.c_str()));
-            screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::FileNotFound;
-        }
-        else
+        if (!check.m_localBaselineScreenshotFilePath.empty())
         {
             // Local screenshots should be expected match 100% every time, otherwise warnings are reported. This will help developers track and investigate changes,
             // for example if they make local changes that impact some unrelated AtomSampleViewer sample in an unexpected way, they will see a warning about this.
-            AZ::Render::FrameCaptureComparisonOutcome compOutcome;
-            AZ::Render::FrameCaptureTestRequestBus::BroadcastResult(
-                compOutcome,
-                &AZ::Render::FrameCaptureTestRequestBus::Events::CompareScreenshots,
-                screenshotTestInfo.m_screenshotFilePath,
-                screenshotTestInfo.m_localBaselineScreenshotFilePath,
-                ImperceptibleDiffFilter
-            );
+            ImageComparisonResult& result = screenshotTestInfo.m_localComparisonResult;
+            result.m_diffScore = 0.0f;
 
-            screenshotTestInfo.m_localComparisonResult.m_diffScore = 0.0f;
-
-            if (compOutcome.IsSuccess())
+            if (check.m_localComparison.m_resultCode == ImageComparisonResult::ResultCode::Pass)
             {
-                screenshotTestInfo.m_localComparisonResult.m_diffScore = compOutcome.GetValue().m_diffScore;
+                result.m_diffScore = check.m_localComparison.m_scores.m_diffScore;
 
-                if (screenshotTestInfo.m_localComparisonResult.m_diffScore == 0.0f)
+                if (result.m_diffScore == 0.0f)
                 {
-                    screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Pass;
+                    result.m_resultCode = ImageComparisonResult::ResultCode::Pass;
                 }
                 else
                 {
                     ReportScreenshotComparisonIssue(
-                        AZStd::string::format("Screenshot check failed. Screenshot does not match the local baseline; something has changed. Diff score is %f.", screenshotTestInfo.m_localComparisonResult.m_diffScore),
+                        AZStd::string::format("Screenshot check failed. Screenshot does not match the local baseline; something has changed. Diff score is %f.", result.m_diffScore),
                         screenshotTestInfo.m_localBaselineScreenshotFilePath,
                         screenshotTestInfo.m_screenshotFilePath,
                         TraceLevel::Warning);
-                    screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
+                    result.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
                 }
             }
+            else
+            {
+                result.m_resultCode = check.m_localComparison.m_resultCode;
+                ReportScriptWarning(AZStd::string::format("Screenshot check failed. Screenshot does not match the local baseline; could not compare with '%s': %s.",
+                    screenshotTestInfo.m_localBaselineScreenshotFilePath.c_str(), result.GetSummaryString().c_str()));
+            }
+        }
+
+        if (swapTraceListener)
+        {
+            scriptReport.BusDisconnect();
+            if (currentScriptReport)
+            {
+                currentScriptReport->BusConnect();
+            }
         }
     }
 
     void ScriptReporter::ExportTestResults()
     {
+        WaitForScreenshotChecks();
+
         m_exportedTestResultsPath = GenerateAndCreateExportedTestResultsPath();
         for (const ScriptReport& scriptReport : m_scriptReports)
         {
@@ -1196,6 +1447,75 @@ namespace AtomSampleViewer
         }
     }
 
+    AZStd::string ScriptReporter::ExportTestResultsJson(uint32_t shardIndex, uint32_t shardCount)
+    {
+        WaitForScreenshotChecks();
+
+        ExportedTestResults results;
+        results.m_shardIndex = shardIndex;
+        results.m_shardCount = shardCount;
+        results.m_scripts.reserve(m_scriptReports.size());
+
+        for (const ScriptReport& scriptReport : m_scriptReports)
+        {
+            ExportedTestResults::Script& script = results.m_scripts.emplace_back();
+            script.m_scriptAssetPath = scriptReport.m_scriptAssetPath;
+            script.m_durationSeconds = scriptReport.m_durationSeconds;
+            script.m_assertCount = scriptReport.m_assertCount;
+            script.m_generalErrorCount = scriptReport.m_generalErrorCount;
+            script.m_screenshotErrorCount = scriptReport.m_screenshotErrorCount;
+            script.m_generalWarningCount = scriptReport.m_generalWarningCount;
+            script.m_screenshotWarningCount = scriptReport.m_screenshotWarningCount;
+
+            for (const ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
+            {
+                ExportedTestResults::Screenshot& screenshot = script.m_screenshots.emplace_back();
+                screenshot.m_screenshotFilePath = screenshotTest.m_screenshotFilePath;
+                screenshot.m_officialBaselineScreenshotFilePath = screenshotTest.m_officialBaselineScreenshotFilePath;
+                screenshot.m_toleranceLevel = screenshotTest.m_toleranceLevel.ToString();
+                screenshot.m_result = screenshotTest.m_officialComparisonResult.GetSummaryString();
+                screenshot.m_passed = screenshotTest.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Pass;
+            }
+        }
+
+        const auto projectPath = AZ::Utils::GetProjectPath();
+        AZStd::string exportTestResultsFolder;
+        AzFramework::StringFunc::Path::Join(projectPath.c_str(), TestResultsFolder, exportTestResultsFolder);
+        AZ::IO::LocalFileIO::GetInstance()->CreatePath(exportTestResultsFolder.c_str());
+
+        const AZStd::string exportFileName = AZStd::string::format("testResults_shard%uof%u.json", shardIndex, shardCount);
+        AZStd::string exportFile;
+        AzFramework::StringFunc::Path::Join(exportTestResultsFolder.c_str(), exportFileName.c_str(), exportFile);
+
+        if (!AZ::JsonSerializationUtils::SaveObjectToFile(&results, exportFile).IsSuccess())
+        {
+            AZ_Error("ScriptReporter", false, "Failed to save test results to file %s", exportFile.c_str());
+            return {};
+        }
+
+        AZ_Printf("ScriptReporter", "Test results exported to %s\n", exportFile.c_str());
+        return exportFile;
+    }
+
+    AZStd::string ScriptReporter::ExportScriptTrace(const AZStd::string& fileName)
+    {
+        const auto projectPath = AZ::Utils::GetProjectPath();
+        AZStd::string exportTestResultsFolder;
+        AzFramework::StringFunc::Path::Join(projectPath.c_str(), TestResultsFolder, exportTestResultsFolder);
+        AZ::IO::LocalFileIO::GetInstance()->CreatePath(exportTestResultsFolder.c_str());
+
+        AZStd::string exportFile;
+        AzFramework::StringFunc::Path::Join(exportTestResultsFolder.c_str(), fileName.c_str(), exportFile);
+
+        if (!m_operationProfiler.ExportChromeTrace(exportFile))
+        {
+            return {};
+        }
+
+        AZ_Printf("ScriptReporter", "Script timing trace exported to %s\n", exportFile.c_str());
+        return exportFile;
+    }
+
     void ScriptReporter::ExportImageDiff(const char* filePath, const ScreenshotTestInfo& screenshotTestInfo)
     {
         using namespace AZ::Utils;
@@ -1203,16 +1523,15 @@ namespace AtomSampleViewer
         PngFile actualScreenshot = PngFile::Load(screenshotTestInfo.m_screenshotFilePath.c_str());
 
         const size_t bufferSize = officialBaseline.GetBuffer().size();
+        if (actualScreenshot.GetBuffer().size() != bufferSize)
+        {
+            AZ_Error("ScriptReporter", false, "Can't export image diff for '%s', the screenshot and baseline are not the same size.", screenshotTestInfo.m_screenshotFilePath.c_str());
+            return;
+        }
 
-        AZStd::vector<uint8_t> diffBuffer = AZStd::vector<uint8_t>(bufferSize);
-        GenerateImageDiff(officialBaseline.GetBuffer(), actualScreenshot.GetBuffer(), diffBuffer);
-
-        AZStd::vector<uint8_t> buffer = AZStd::vector<uint8_t>(bufferSize * 3);
-        memcpy(buffer.data(), officialBaseline.GetBuffer().data(), bufferSize);
-        memcpy(buffer.data() + bufferSize, actualScreenshot.GetBuffer().data(), bufferSize);
-        memcpy(buffer.data() + bufferSize * 2, diffBuffer.data(), bufferSize);
+        AZStd::vector<uint8_t> buffer = ImageDiff::CreateDiffReportImage(officialBaseline.GetBuffer(), actualScreenshot.GetBuffer());
 
-        PngFile imageDiff = PngFile::Create(AZ::RHI::Size(officialBaseline.GetWidth(), officialBaseline.GetHeight() * 3, 1), AZ::RHI::Format::R8G8B8A8_UNORM, buffer);
+        PngFile imageDiff = PngFile::Create(AZ::RHI::Size(officialBaseline.GetWidth(), officialBaseline.GetHeight() * 3, 1), AZ::RHI::Format::R8G8B8A8_UNORM, AZStd::move(buffer));
         imageDiff.Save(filePath);
     }
 
@@ -1240,28 +1559,6 @@ namespace AtomSampleViewer
         return exportFile;
     }
 
-    void ScriptReporter::GenerateImageDiff(AZStd::span<const uint8_t> img1, AZStd::span<const uint8_t> img2, AZStd::vector<uint8_t>& buffer)
-    {
-        static constexpr size_t BytesPerPixel = 4;
-        static constexpr float MinDiffFilter = 0.01;
-        static constexpr uint8_t DefaultPixelValue = 122;
-
-        memset(buffer.data(), DefaultPixelValue, buffer.size() * sizeof(uint8_t));
-
-        for (size_t i = 0; i < img1.size(); i += BytesPerPixel)
-        {
-            const int16_t maxDiff = AZ::Utils::CalcMaxChannelDifference(img1, img2, i);
-
-            if (maxDiff / 255.0f > MinDiffFilter)
-            {
-                buffer[i] = aznumeric_cast<uint8_t>(maxDiff);
-                buffer[i + 1] = 0;
-                buffer[i + 2] = 0;
-            }
-            buffer[i + 3] = 255;
-        }
-    }
-
     void ScriptReporter::HighlightColorSettings::UpdateColorSettings()
     {
         const ImVec4& bgColor = ImGui::GetStyleColorVec4(ImGuiCol_WindowBg);
@@ -9,15 +9,28 @@
 #pragma once
 
 #include <AzCore/Debug/TraceMessageBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <Atom/Feature/Utils/FrameCaptureBus.h>
 #include <Atom/Feature/Utils/FrameCaptureTestBus.h>
 #include <Atom/Utils/ImageComparison.h>
+#include <Automation/BaselineImageCache.h>
 #include <Automation/ImageComparisonConfig.h>
+#include <Automation/ImageDiff.h>
+#include <Automation/ScriptOperationProfiler.h>
 #include <Utils/ImGuiMessageBox.h>
 #include <Atom/Utils/PngFile.h>
 #include <imgui/imgui.h>
 
+namespace AZ
+{
+    class ReflectContext;
+}
+
 namespace AtomSampleViewer
 {
     struct ImageComparisonToleranceLevel;
@@ -33,6 +46,10 @@ namespace AtomSampleViewer
         static constexpr const char* TestResultsFolder = "TestResults";
         static constexpr const char* UserFolder = "user";
 
+        static void Reflect(AZ::ReflectContext* context);
+
+        ~ScriptReporter();
+
         //! Set the list of available tolerance levels, so the report can suggest an alternate level that matches the actual results.
         void SetAvailableToleranceLevels(const AZStd::vector<ImageComparisonToleranceLevel>& toleranceLevels);
 
@@ -59,8 +76,18 @@ namespace AtomSampleViewer
         bool AddScreenshotTest(const AZStd::string& imageName);
 
         //! Check the latest screenshot using default thresholds.
+        //! The comparison runs on the job system; its results are reported by ProcessCompletedScreenshotChecks() or WaitForScreenshotChecks().
         void CheckLatestScreenshot(const ImageComparisonToleranceLevel* comparisonPreset);
 
+        //! Reports the results of any screenshot comparisons that have finished. This does not block.
+        void ProcessCompletedScreenshotChecks();
+
+        //! Blocks until all screenshot comparisons have finished, and reports their results.
+        void WaitForScreenshotChecks();
+
+        //! Returns whether any screenshot comparisons have not been reported yet.
+        bool HasPendingScreenshotChecks() const;
+
         //! Opens the script report dialog.
         //! This displays all the collected script reporting data, provides links to tools for analyzing data like
         //! viewing screenshot diffs. It can be left open during processing and will update in real-time.
@@ -175,6 +202,9 @@ namespace AtomSampleViewer
 
             AZStd::string m_scriptAssetPath;
 
+            AZStd::chrono::steady_clock::time_point m_startTime;
+            double m_durationSeconds = 0.0; //!< Time from PushScript() to PopScript(), including any scripts it ran
+
             uint32_t m_assertCount = 0;
 
             uint32_t m_generalErrorCount = 0;
@@ -188,13 +218,67 @@ namespace AtomSampleViewer
 
         const AZStd::vector<ScriptReport>& GetScriptReport() const { return m_scriptReports; }
 
+        //! Machine readable results of a test run, which are exported at the end of an automated test suite run.
+        //! A suite can be split into shards that run in separate processes, each one exporting the results of its scripts.
+        //! Standalone/PythonTests/Automated/merge_test_results.py combines them into a single report.
+        struct ExportedTestResults
+        {
+            AZ_TYPE_INFO(ExportedTestResults, "{3C9A5E71-8D24-4F0B-B6E2-1A7D9C4F5E83}");
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            struct Screenshot
+            {
+                AZ_TYPE_INFO(Screenshot, "{A8E14B3D-67C2-4D95-8F0A-2B5C9E7D1F46}");
+
+                static void Reflect(AZ::ReflectContext* context);
+
+                AZStd::string m_screenshotFilePath;
+                AZStd::string m_officialBaselineScreenshotFilePath;
+                AZStd::string m_toleranceLevel;
+                AZStd::string m_result;
+                bool m_passed = false;
+            };
+
+            struct Script
+            {
+                AZ_TYPE_INFO(Script, "{5D27F0C8-B3A1-4E6D-9C84-7F1E2A6B0D39}");
+
+                static void Reflect(AZ::ReflectContext* context);
+
+                AZStd::string m_scriptAssetPath;
+                double m_durationSeconds = 0.0;
+                uint32_t m_assertCount = 0;
+                uint32_t m_generalErrorCount = 0;
+                uint32_t m_screenshotErrorCount = 0;
+                uint32_t m_generalWarningCount = 0;
+                uint32_t m_screenshotWarningCount = 0;
+                AZStd::vector<Screenshot> m_screenshots;
+            };
+
+            uint32_t m_shardIndex = 0;
+            uint32_t m_shardCount = 1;
+            AZStd::vector<Script> m_scripts;
+        };
+
         // For exporting test results
         void ExportTestResults();
+
+        //! Saves the ExportedTestResults of all the scripts to "<project>/TestResults/testResults_shard<index>of<count>.json".
+        //! Returns the path of the file, or an empty string if it couldn't be saved.
+        AZStd::string ExportTestResultsJson(uint32_t shardIndex, uint32_t shardCount);
         void ExportImageDiff(const char* filePath, const ScreenshotTestInfo& screenshotTest);
         AZStd::string ExportImageDiff(const ScriptReport& scriptReport, const ScreenshotTestInfo& screenshotTest);
 
         void SortScriptReports();
 
+        //! Times the scripts and script operations of the current run
+        ScriptOperationProfiler& GetOperationProfiler() { return m_operationProfiler; }
+
+        //! Saves the timing profile of the run as a Chrome trace in "<project>/TestResults/<fileName>".
+        //! Returns the path of the file, or an empty string if it couldn't be saved.
+        AZStd::string ExportScriptTrace(const AZStd::string& fileName);
+
     private:
         static const ImGuiTreeNodeFlags FlagDefaultOpen = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_DefaultOpen;
         static const ImGuiTreeNodeFlags FlagDefaultClosed = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
@@ -244,6 +328,35 @@ namespace AtomSampleViewer
         // Show a message box to let the user know the results of updating local baseline images
         void ShowUpdateLocalBaselineResult(int successCount, int failureCount);
 
+        //! The outcome of comparing a screenshot against one baseline image.
+        struct BaselineComparison
+        {
+            ImageComparisonResult::ResultCode m_resultCode = ImageComparisonResult::ResultCode::None; //!< Pass if m_scores are valid; the threshold is applied later
+            ImageDiff::DiffScores m_scores;
+        };
+
+        //! A screenshot comparison running on the job system. The job writes the outcomes and then sets m_isFinished,
+        //! after which the results are reported on the main thread.
+        struct PendingScreenshotCheck
+        {
+            AZStd::string m_screenshotFilePath;
+            AZStd::string m_officialBaselineScreenshotFilePath; //!< Empty if there is no official baseline to compare against
+            AZStd::string m_localBaselineScreenshotFilePath;    //!< Empty if there is no local baseline to compare against
+            BaselineComparison m_officialComparison;
+            BaselineComparison m_localComparison;
+            AZStd::atomic_bool m_isFinished{ false };
+            AZ::JobCompletion m_completion;
+        };
+
+        // Runs on a job thread. Compares the screenshot against both baselines, decoding it at most once.
+        static void RunScreenshotCheck(PendingScreenshotCheck& check, BaselineImageCache& baselineImageCache);
+
+        // Reads the baseline cache settings from the settings registry.
+        void ConfigureBaselineImageCache();
+
+        // Applies the outcomes of a finished comparison to its ScreenshotTestInfo and reports any issues against the script that requested it.
+        void FinishScreenshotCheck(const ReportIndex& reportIndex, PendingScreenshotCheck& check);
+
         const ImageComparisonToleranceLevel* FindBestToleranceLevel(float diffScore, bool filterImperceptibleDiffs) const;
 
         void ShowReportDialog();
@@ -255,9 +368,6 @@ namespace AtomSampleViewer
         AZStd::string GenerateAndCreateExportedImageDiffPath(const ScriptReport& scriptReport, const ScreenshotTestInfo& screenshotTest) const;
         AZStd::string GenerateAndCreateExportedTestResultsPath() const;
 
-        // Generates a diff between two images of the same size.
-        void GenerateImageDiff(AZStd::span<const uint8_t> img1, AZStd::span<const uint8_t> img2, AZStd::vector<uint8_t>& buffer);
-
         ScriptReport* GetCurrentScriptReport();
 
         AZStd::string SeeConsole(uint32_t issueCount, const char* searchString);
@@ -288,6 +398,9 @@ namespace AtomSampleViewer
 
         AZStd::vector<ScriptReport> m_scriptReports; //< Tracks errors for the current active script
         AZStd::vector<size_t> m_currentScriptIndexStack; //< Tracks which of the scripts in m_scriptReports is currently active
+        AZStd::unordered_map<ReportIndex, AZStd::unique_ptr<PendingScreenshotCheck>> m_pendingScreenshotChecks; //< Screenshot comparisons that have not been reported yet
+        BaselineImageCache m_baselineImageCache; //< Decoded baseline images, kept across runs so retried scripts don't decode them again
+        ScriptOperationProfiler m_operationProfiler;
         bool m_showReportDialog = false;
         bool m_colorHasBeenSet = false;
         DisplayOption m_displayOption = DisplayOption::AllResults;
@@ -8,7 +8,6 @@
 
 #include <Automation/ScriptableImGui.h>
 #include <Automation/ScriptRepeaterBus.h>
-#include <AzFramework/StringFunc/StringFunc.h>
 #include <Utils/Utils.h>
 
 #include <SampleComponentManagerBus.h>
@@ -29,41 +28,78 @@ namespace AtomSampleViewer
     {
         ScriptableImGui* s_instance = GetInstance();
         AZ_Error("Automation", s_instance->m_scriptedActions.empty(), "Not all scripted ImGui actions were consumed");
-        for (auto iter : s_instance->m_scriptedActions)
+        for (const auto& iter : s_instance->m_scriptedActions)
         {
-            AZ_Error("Automation", false, "Scripted action for '%s' not consumed", iter.first.c_str());
+            AZ_Error("Automation", false, "Scripted action for '%s' not consumed", iter.second.m_pathToImGuiItem.c_str());
         }
 
-        AZ_Error("Automation", s_instance->m_nameContextStack.empty(), "PushNameContext and PopNameContext calls didn't match");
+        AZ_Error("Automation", s_instance->m_nameContextDepth == 0, "PushNameContext and PopNameContext calls didn't match");
     }
 
     void ScriptableImGui::ClearActions()
     {
         ScriptableImGui* s_instance = GetInstance();
         s_instance->m_scriptedActions.clear();
-        s_instance->m_nameContextStack.clear();
+        s_instance->m_nameContextDepth = 0;
     }
 
-    void ScriptableImGui::PushNameContext(const AZStd::string& nameContext)
+    AZ::u64 ScriptableImGui::HashPath(AZ::u64 hash, AZStd::string_view text)
     {
+        constexpr AZ::u64 FnvPrime = 0x100000001b3ull;
+        for (char c : text)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= FnvPrime;
+        }
+        return hash;
+    }
+
+    void ScriptableImGui::PushNameContext(AZStd::string_view nameContext)
+    {
+        static constexpr AZStd::string_view Delimiter = "/";
+
         ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_nameContextStack.push_back(nameContext);
+        const AZ::u64 parentHash = s_instance->m_nameContextDepth > 0 ? s_instance->m_nameContextStack[s_instance->m_nameContextDepth - 1].m_pathHash : EmptyPathHash;
+
+        if (s_instance->m_nameContextDepth == s_instance->m_nameContextStack.size())
+        {
+            s_instance->m_nameContextStack.emplace_back();
+        }
+
+        // Assigning keeps the capacity of the string, so the same names don't allocate every frame
+        NameContext& context = s_instance->m_nameContextStack[s_instance->m_nameContextDepth++];
+        context.m_name.assign(nameContext.data(), nameContext.size());
+        context.m_pathHash = HashPath(HashPath(parentHash, nameContext), Delimiter);
     }
 
     void ScriptableImGui::PopNameContext()
     {
         ScriptableImGui* s_instance = GetInstance();
-        AZ_Assert(!s_instance->m_nameContextStack.empty(), "Called PopNameContext too many times");
-        s_instance->m_nameContextStack.pop_back();
+        AZ_Assert(s_instance->m_nameContextDepth > 0, "Called PopNameContext too many times");
+        --s_instance->m_nameContextDepth;
+    }
+
+    AZ::u64 ScriptableImGui::HashFullPath(AZStd::string_view forLabel)
+    {
+        ScriptableImGui* s_instance = GetInstance();
+        const AZ::u64 contextHash = s_instance->m_nameContextDepth > 0 ? s_instance->m_nameContextStack[s_instance->m_nameContextDepth - 1].m_pathHash : EmptyPathHash;
+        return HashPath(contextHash, forLabel);
     }
 
-    ScriptableImGui::ActionItem ScriptableImGui::FindAndRemoveAction(const AZStd::string& pathToImGuiItem)
+    ScriptableImGui::ActionItem ScriptableImGui::FindAndRemoveAction(const char* label)
     {
         ScriptableImGui* s_instance = GetInstance();
-        auto iter = s_instance->m_scriptedActions.find(pathToImGuiItem);
-        if (iter != s_instance->m_scriptedActions.end())
+
+        // Nothing is scheduled when no script is running, so there's no need to hash the label
+        if (s_instance->m_scriptedActions.empty())
+        {
+            return ScriptableImGui::ActionItem{};
+        }
+
+        auto iter = s_instance->m_scriptedActions.find(HashFullPath(label));
+        if (iter != s_instance->m_scriptedActions.end() && iter->second.m_pathToImGuiItem == MakeFullPath(label))
         {
-            ScriptableImGui::ActionItem item = AZStd::move(iter->second);
+            ScriptableImGui::ActionItem item = AZStd::move(iter->second.m_actionItem);
             s_instance->m_scriptedActions.erase(iter);
             return AZStd::move(item);
         }
@@ -71,18 +107,18 @@ namespace AtomSampleViewer
         return ScriptableImGui::ActionItem{};
     }
 
-    AZStd::string ScriptableImGui::MakeFullPath(const AZStd::string& forLabel)
+    AZStd::string ScriptableImGui::MakeFullPath(AZStd::string_view forLabel)
     {
         ScriptableImGui* s_instance = GetInstance();
         static constexpr char Delimiter[] = "/";
 
         AZStd::string fullPath;
-        if (!s_instance->m_nameContextStack.empty())
+        for (size_t i = 0; i < s_instance->m_nameContextDepth; ++i)
         {
-            AzFramework::StringFunc::Join(fullPath, s_instance->m_nameContextStack.begin(), s_instance->m_nameContextStack.end(), Delimiter);
+            fullPath += s_instance->m_nameContextStack[i].m_name;
             fullPath += Delimiter;
         }
-        fullPath += forLabel;
+        fullPath.append(forLabel.data(), forLabel.size());
 
         return fullPath;
     }
@@ -92,56 +128,60 @@ namespace AtomSampleViewer
         AZ_Error("Automation", false, "Script: %s", message);
     }
 
-    void ScriptableImGui::SetBool(const AZStd::string& pathToImGuiItem, bool value)
+    void ScriptableImGui::SetAction(AZStd::string_view pathToImGuiItem, ActionItem&& actionItem)
     {
         ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_scriptedActions[pathToImGuiItem] = value;
+        ScriptedAction& action = s_instance->m_scriptedActions[HashPath(EmptyPathHash, pathToImGuiItem)];
+        AZ_Error("Automation", action.m_pathToImGuiItem.empty() || AZStd::string_view(action.m_pathToImGuiItem) == pathToImGuiItem,
+            "Script field IDs '%s' and '%.*s' have the same hash", action.m_pathToImGuiItem.c_str(), AZ_STRING_ARG(pathToImGuiItem));
+        action.m_pathToImGuiItem.assign(pathToImGuiItem.data(), pathToImGuiItem.size());
+        action.m_actionItem = AZStd::move(actionItem);
     }
 
-    void ScriptableImGui::SetNumber(const AZStd::string& pathToImGuiItem, float value)
+    void ScriptableImGui::SetBool(AZStd::string_view pathToImGuiItem, bool value)
     {
-        ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_scriptedActions[pathToImGuiItem] = value;
+        SetAction(pathToImGuiItem, ActionItem(value));
     }
 
-    void ScriptableImGui::SetVector(const AZStd::string& pathToImGuiItem, const AZ::Vector2& value)
+    void ScriptableImGui::SetNumber(AZStd::string_view pathToImGuiItem, float value)
     {
-        ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_scriptedActions[pathToImGuiItem] = value;
+        SetAction(pathToImGuiItem, ActionItem(value));
     }
 
-    void ScriptableImGui::SetVector(const AZStd::string& pathToImGuiItem, const AZ::Vector3& value)
+    void ScriptableImGui::SetVector(AZStd::string_view pathToImGuiItem, const AZ::Vector2& value)
     {
-        ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_scriptedActions[pathToImGuiItem] = value;
+        SetAction(pathToImGuiItem, ActionItem(value));
     }
 
-    void ScriptableImGui::SetString(const AZStd::string& pathToImGuiItem, const AZStd::string& value)
+    void ScriptableImGui::SetVector(AZStd::string_view pathToImGuiItem, const AZ::Vector3& value)
     {
-        ScriptableImGui* s_instance = GetInstance();
-        s_instance->m_scriptedActions[pathToImGuiItem] = value;
+        SetAction(pathToImGuiItem, ActionItem(value));
+    }
+
+    void ScriptableImGui::SetString(AZStd::string_view pathToImGuiItem, AZStd::string_view value)
+    {
+        SetAction(pathToImGuiItem, ActionItem(AZStd::string(value)));
     }
 
-    template<typename ActionDataT>
+    template<typename ActionDataT, typename ImGuiActionT, typename ReportActionT, typename HandleActionT>
     bool ScriptableImGui::ActionHelper(
         const char* label,
-        AZStd::function<bool()> imguiAction,
-        AZStd::function<void(const AZStd::string& /*pathToImGuiItem*/)> reportScriptableAction,
-        AZStd::function<bool(ActionDataT /*scriptArg*/)> handleScriptedAction,
+        ImGuiActionT&& imguiAction,
+        ReportActionT&& reportScriptableAction,
+        HandleActionT&& handleScriptedAction,
         bool shouldReportScriptableActionAfterAnyChange)
     {
         bool imResult = imguiAction();
 
-        const AZStd::string pathToImGuiItem = MakeFullPath(label);
-
+        // The full path is only built when it's needed, which is rare
         if (ImGui::IsItemDeactivatedAfterEdit() || (shouldReportScriptableActionAfterAnyChange && imResult))
         {
-            reportScriptableAction(pathToImGuiItem);
+            reportScriptableAction(MakeFullPath(label));
         }
 
         bool scriptResult = false;
 
-        ActionItem actionItem = FindAndRemoveAction(pathToImGuiItem);
+        ActionItem actionItem = FindAndRemoveAction(label);
         bool foundAction = !AZStd::holds_alternative<InvalidActionItem>(actionItem);
         if (foundAction)
         {
@@ -151,7 +191,7 @@ namespace AtomSampleViewer
             }
             else
             {
-                ReportScriptError(AZStd::string::format("Wrong data type used to set '%s'", pathToImGuiItem.c_str()).c_str());
+                ReportScriptError(AZStd::string::format("Wrong data type used to set '%s'", MakeFullPath(label).c_str()).c_str());
             }
         }
 
@@ -510,8 +550,6 @@ namespace AtomSampleViewer
     {
         ScriptableImGui* s_instance = GetInstance();
 
-        const AZStd::string pathToImGuiItem = MakeFullPath(label);
-
         if (ImGui::BeginCombo(label, preview_value, flags))
         {
             PushNameContext(label);
@@ -555,9 +593,7 @@ namespace AtomSampleViewer
         // Also, we don't include a "scriptResult", just the "imResult", because we need to ensure that ImGui is in the actual
         // state we are reporting back to the caller. Otherwise the internal state of ImGui could become invalid and crash.
 
-        const AZStd::string pathToImGuiItem = MakeFullPath(label);
-        
-        ActionItem actionItem = FindAndRemoveAction(pathToImGuiItem);
+        ActionItem actionItem = FindAndRemoveAction(label);
         bool foundAction = !AZStd::holds_alternative<InvalidActionItem>(actionItem);
         if (foundAction)
         {
@@ -585,7 +621,7 @@ namespace AtomSampleViewer
 
             if (!wasPopupOpen && isPopupOpen)
             {
-                Utils::ReportScriptableAction("SetImguiValue('%s', true)", pathToImGuiItem.c_str());
+                Utils::ReportScriptableAction("SetImguiValue('%s', true)", MakeFullPath(label).c_str());
             }
         }
 
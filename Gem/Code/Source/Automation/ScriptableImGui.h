@@ -10,7 +10,9 @@
 
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <imgui/imgui.h>
@@ -38,7 +40,7 @@ namespace AtomSampleViewer
         class ScopedNameContext final
         {
         public:
-            ScopedNameContext(const AZStd::string& nameContext) { ScriptableImGui::PushNameContext(nameContext); }
+            ScopedNameContext(AZStd::string_view nameContext) { ScriptableImGui::PushNameContext(nameContext); }
             ~ScopedNameContext() { ScriptableImGui::PopNameContext(); }
         };
 
@@ -54,7 +56,8 @@ namespace AtomSampleViewer
         //!     PopNameContext();
         //! This is especially useful for disambiguating similar ImGui labels.
         //! There is also a ScopedNameContext utility class for managing the push/pop using the call stack.
-        static void PushNameContext(const AZStd::string& nameContext);
+        //! The name contexts are hashed as they are pushed, so looking up scripted actions doesn't build the full path strings.
+        static void PushNameContext(AZStd::string_view nameContext);
         static void PopNameContext();
 
         //////////////////////////////////////////////////////////////////
@@ -110,11 +113,11 @@ namespace AtomSampleViewer
         //! These functions are called through scripts to schedule a scripted action.
         //! This data will be consumed by subsequent calls to ImGui API functions.
         //! @param pathToImGuiItem - full path to an ImGui item, including the name context
-        static void SetBool(const AZStd::string& name, bool value);
-        static void SetNumber(const AZStd::string& name, float value);
-        static void SetVector(const AZStd::string& name, const AZ::Vector2& value);
-        static void SetVector(const AZStd::string& name, const AZ::Vector3& value);
-        static void SetString(const AZStd::string& name, const AZStd::string& value);
+        static void SetBool(AZStd::string_view name, bool value);
+        static void SetNumber(AZStd::string_view name, float value);
+        static void SetVector(AZStd::string_view name, const AZ::Vector2& value);
+        static void SetVector(AZStd::string_view name, const AZ::Vector3& value);
+        static void SetString(AZStd::string_view name, AZStd::string_view value);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -123,31 +126,59 @@ namespace AtomSampleViewer
         using ActionItem = AZStd::variant<InvalidActionItem, bool, float, AZ::Vector2, AZ::Vector3, AZStd::string>;
 
         //! This utility function factors out common steps that most of the ImGui API bridge functions must perform.
-        template<typename ActionDataT>
+        //! The callbacks are template parameters rather than AZStd::functions so bridging a widget doesn't allocate.
+        //! @param imguiAction - bool(), calls the ImGui function
+        //! @param reportScriptableAction - void(const AZStd::string& pathToImGuiItem)
+        //! @param handleScriptedAction - bool(ActionDataT scriptArg)
+        template<typename ActionDataT, typename ImGuiActionT, typename ReportActionT, typename HandleActionT>
         static bool ActionHelper(
             const char* label,
-            AZStd::function<bool()> imguiAction,
-            AZStd::function<void(const AZStd::string& /*pathToImGuiItem*/)> reportScriptableAction,
-            AZStd::function<bool(ActionDataT /*scriptArg*/)> handleScriptedAction,
+            ImGuiActionT&& imguiAction,
+            ReportActionT&& reportScriptableAction,
+            HandleActionT&& handleScriptedAction,
             bool shouldReportScriptableActionAfterAnyChange = false);
 
         template<typename ImGuiActionType>
         static bool ThreeComponentHelper(const char* label, float v[3], ImGuiActionType& imguiAction);
 
-        //! Finds a scheduled script action and removes it from the list of actions.
-        //! @param pathToImGuiItem - full path to an ImGui item, including the name context
-        static ActionItem FindAndRemoveAction(const AZStd::string& pathToImGuiItem);
+        //! Finds a scheduled script action for the ImGui label in the current name context, and removes it from the list of actions.
+        static ActionItem FindAndRemoveAction(const char* label);
 
         //! Makes a full script field ID path for the given ImGui label, by prefixing the current name context
-        static AZStd::string MakeFullPath(const AZStd::string& forLabel);
+        static AZStd::string MakeFullPath(AZStd::string_view forLabel);
+
+        //! Continues an FNV-1a hash of a script field ID path with more characters. Hashing a path in pieces gives the same result as hashing it at once.
+        static AZ::u64 HashPath(AZ::u64 hash, AZStd::string_view text);
+        static constexpr AZ::u64 EmptyPathHash = 0xcbf29ce484222325ull;
+
+        //! Returns the hash of the full path of the given ImGui label, without building the path
+        static AZ::u64 HashFullPath(AZStd::string_view forLabel);
+
+        //! Schedules a scripted action
+        static void SetAction(AZStd::string_view pathToImGuiItem, ActionItem&& actionItem);
 
         //! Utility function to ensure all script errors use a similar format
         static void ReportScriptError(const char* message);
 
+        struct NameContext
+        {
+            AZStd::string m_name;
+            AZ::u64 m_pathHash = EmptyPathHash; //!< Hash of the path up to and including this name context and the delimiter that follows it
+        };
+
         //! Provides a name context prefix to script field IDs for disambiguation.
-        AZStd::vector<AZStd::string> m_nameContextStack; 
+        //! Entries past m_nameContextDepth are kept so their strings can be reused without allocating.
+        AZStd::vector<NameContext> m_nameContextStack;
+        size_t m_nameContextDepth = 0;
+
+        struct ScriptedAction
+        {
+            AZStd::string m_pathToImGuiItem; //!< To tell apart paths with the same hash, and for error messages
+            ActionItem m_actionItem;
+        };
 
-        using ActionMap = AZStd::unordered_map<AZStd::string, ActionItem>;
+        //! Scripted actions by the hash of the full path of their ImGui item
+        using ActionMap = AZStd::unordered_map<AZ::u64, ScriptedAction>;
         ActionMap m_scriptedActions;
 
         bool m_isInScriptedComboPopup = false;
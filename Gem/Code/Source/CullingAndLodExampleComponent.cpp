@@ -76,7 +76,16 @@ namespace AtomSampleViewer
         SaveCameraConfiguration();
         ResetNoClipController();        
 
+        BenchmarkHarness::Config benchmarkConfig;
+        benchmarkConfig.m_name = "Culling and LOD";
+        benchmarkConfig.m_outputName = "cullingAndLod";
+        benchmarkConfig.m_cameraEntityId = GetCameraEntityId();
+        m_benchmarkHarness.ActivateIfRequested(benchmarkConfig);
+
+        // The models are loaded synchronously, so loading is done when the scene is set up.
+        m_benchmarkHarness.BenchmarkLoadStart();
         SetupScene();
+        m_benchmarkHarness.BenchmarkLoadEnd();
 
         m_imguiSidebar.Activate();
 
@@ -89,6 +98,8 @@ namespace AtomSampleViewer
 
         TickBus::Handler::BusDisconnect();
 
+        m_benchmarkHarness.Deactivate();
+
         m_imguiSidebar.Deactivate();
 
         // disable camera control
@@ -103,11 +114,10 @@ namespace AtomSampleViewer
 
     void CullingAndLodExampleComponent::OnTick(float deltaTime, AZ::ScriptTimePoint timePoint)
     {
-        AZ_UNUSED(deltaTime);
-        AZ_UNUSED(timePoint);
-
         using namespace AZ;
 
+        m_benchmarkHarness.Tick(deltaTime, timePoint);
+
         DrawSidebar();
 
         // Pass camera data to the DirectionalLightFeatureProcessor
@@ -20,6 +20,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Random.h>
 #include <AzFramework/Entity/EntityContext.h>
+#include <Utils/BenchmarkHarness.h>
 #include <Utils/ImGuiSidebar.h>
 
 namespace AtomSampleViewer
@@ -102,6 +103,8 @@ namespace AtomSampleViewer
         AZStd::vector<AZ::Render::MeshFeatureProcessorInterface::MeshHandle> m_meshHandles;
         AZStd::vector<AZ::Render::MeshHandleDescriptor::ModelChangedEvent::Handler> m_modelChangedHandlers;
 
+        BenchmarkHarness m_benchmarkHarness;
+
         // GUI
         ImGuiSidebar m_imguiSidebar;
         float m_directionalLightPitch = -1.22;
@@ -11,6 +11,9 @@
 #include <Atom/Component/DebugCamera/NoClipControllerComponent.h>
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
 
 #include <AzFramework/Components/TransformComponent.h>
 
@@ -30,6 +33,7 @@ namespace AtomSampleViewer
     constexpr float s_spacingMin = 0.5f;
     constexpr float s_entityScaleMax = 10.0f;
     constexpr float s_entityScaleMin = 0.1f;
+    constexpr int32_t s_transformsPerJob = 4096;
 
     void EntityLatticeTestComponent::Reflect(ReflectContext* context)
     {
@@ -55,6 +59,7 @@ namespace AtomSampleViewer
         Debug::CameraControllerRequestBus::Event(GetCameraEntityId(), &Debug::CameraControllerRequestBus::Events::Disable);
 
         DestroyLatticeInstances();
+        m_builtSettings = {};
         m_defaultIbl.Reset();
     }
 
@@ -68,30 +73,139 @@ namespace AtomSampleViewer
     {
         PrepareCreateLatticeInstances(GetInstanceCount());
 
-        // We first rotate the model by 180 degrees before translating it. This is to make it face the camera as it did
-        // when the world was Y-up.
-        Transform transform = Transform::CreateRotationZ(Constants::Pi);
-        m_worldAabb = AZ::Aabb::CreateNull();
+        BuildLatticeTransforms();
+        UpdateLatticeAabb();
+
+        CreateLatticeInstances(m_latticeTransforms);
+        FinalizeLatticeInstances();
+        SaveBuiltLatticeSettings();
+    }
+
+    void EntityLatticeTestComponent::UpdateLattice()
+    {
+        const BuiltLatticeSettings& built = m_builtSettings;
+        if (!SupportsIncrementalLatticeUpdates() || built.m_width == 0)
+        {
+            RebuildLattice();
+            return;
+        }
+
+        const bool dimensionsChanged = built.m_width != m_latticeWidth || built.m_depth != m_latticeDepth || built.m_height != m_latticeHeight;
+        const bool transformsChanged = built.m_spacingX != m_spacingX || built.m_spacingY != m_spacingY || built.m_spacingZ != m_spacingZ ||
+            built.m_entityScale != m_entityScale;
+        if (!dimensionsChanged && !transformsChanged)
+        {
+            return;
+        }
 
+        // Map each cell of the new lattice to the same x, y, z cell of the previous one
+        AZStd::vector<uint32_t> previousIndices;
+        previousIndices.reserve(GetInstanceCount());
         for (int32_t x = 0; x < m_latticeWidth; ++x)
         {
             for (int32_t y = 0; y < m_latticeDepth; ++y)
             {
                 for (int32_t z = 0; z < m_latticeHeight; ++z)
                 {
-                    Vector3 position(
-                        static_cast<float>(x) * m_spacingX,
-                        static_cast<float>(y) * m_spacingY,
-                        static_cast<float>(z) * m_spacingZ);
-
-                    transform.SetTranslation(position);
-                    transform.SetUniformScale(m_entityScale);
-                    CreateLatticeInstance(transform);
-                    m_worldAabb.AddPoint(transform.GetTranslation());
+                    const bool existed = x < built.m_width && y < built.m_depth && z < built.m_height;
+                    previousIndices.push_back(existed ? static_cast<uint32_t>((x * built.m_depth + y) * built.m_height + z) : InvalidCellIndex);
                 }
             }
         }
-        FinalizeLatticeInstances();
+
+        BuildLatticeTransforms();
+        UpdateLatticeAabb();
+
+        UpdateLatticeInstances(previousIndices, m_latticeTransforms, transformsChanged);
+        SaveBuiltLatticeSettings();
+    }
+
+    void EntityLatticeTestComponent::UpdateLatticeAabb()
+    {
+        // The positions are a grid starting at the origin, so the last cell alone gives the extent of the lattice
+        m_worldAabb = AZ::Aabb::CreateFromMinMax(
+            Vector3::CreateZero(),
+            Vector3(
+                static_cast<float>(m_latticeWidth - 1) * m_spacingX,
+                static_cast<float>(m_latticeDepth - 1) * m_spacingY,
+                static_cast<float>(m_latticeHeight - 1) * m_spacingZ));
+    }
+
+    void EntityLatticeTestComponent::SaveBuiltLatticeSettings()
+    {
+        m_builtSettings.m_width = m_latticeWidth;
+        m_builtSettings.m_height = m_latticeHeight;
+        m_builtSettings.m_depth = m_latticeDepth;
+        m_builtSettings.m_spacingX = m_spacingX;
+        m_builtSettings.m_spacingY = m_spacingY;
+        m_builtSettings.m_spacingZ = m_spacingZ;
+        m_builtSettings.m_entityScale = m_entityScale;
+    }
+
+    void EntityLatticeTestComponent::BuildLatticeTransforms()
+    {
+        m_latticeTransforms.resize(GetInstanceCount());
+
+        // We first rotate the model by 180 degrees before translating it. This is to make it face the camera as it did
+        // when the world was Y-up.
+        Transform baseTransform = Transform::CreateRotationZ(Constants::Pi);
+        baseTransform.SetUniformScale(m_entityScale);
+
+        const int32_t transformsPerSlice = m_latticeDepth * m_latticeHeight;
+
+        // Each x slice of the lattice is a contiguous range of m_latticeTransforms, so slices can be filled independently
+        auto buildSlices = [this, &baseTransform, transformsPerSlice](int32_t firstX, int32_t endX)
+        {
+            Transform* transform = m_latticeTransforms.data() + static_cast<size_t>(firstX) * transformsPerSlice;
+            for (int32_t x = firstX; x < endX; ++x)
+            {
+                for (int32_t y = 0; y < m_latticeDepth; ++y)
+                {
+                    for (int32_t z = 0; z < m_latticeHeight; ++z)
+                    {
+                        *transform = baseTransform;
+                        transform->SetTranslation(Vector3(
+                            static_cast<float>(x) * m_spacingX,
+                            static_cast<float>(y) * m_spacingY,
+                            static_cast<float>(z) * m_spacingZ));
+                        ++transform;
+                    }
+                }
+            }
+        };
+
+        const int32_t slicesPerJob = AZStd::max(1, s_transformsPerJob / transformsPerSlice);
+        if (m_latticeWidth <= slicesPerJob)
+        {
+            buildSlices(0, m_latticeWidth);
+            return;
+        }
+
+        JobCompletion completion;
+        for (int32_t firstX = 0; firstX < m_latticeWidth; firstX += slicesPerJob)
+        {
+            const int32_t endX = AZStd::min(firstX + slicesPerJob, m_latticeWidth);
+            Job* job = CreateJobFunction([&buildSlices, firstX, endX]()
+                {
+                    buildSlices(firstX, endX);
+                }, true);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+    }
+
+    void EntityLatticeTestComponent::CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms)
+    {
+        for (const Transform& transform : transforms)
+        {
+            CreateLatticeInstance(transform);
+        }
+    }
+
+    void EntityLatticeTestComponent::CreateLatticeInstance([[maybe_unused]] const AZ::Transform& transform)
+    {
+        AZ_Assert(false, "Subclasses of EntityLatticeTestComponent must override CreateLatticeInstance() or CreateLatticeInstances().");
     }
 
     uint32_t EntityLatticeTestComponent::GetInstanceCount() const
@@ -176,7 +290,7 @@ namespace AtomSampleViewer
 
         if (latticeChanged)
         {
-            RebuildLattice();
+            UpdateLattice();
         }
     }
 } // namespace AtomSampleViewer
@@ -13,6 +13,10 @@
 #include <EntityLatticeTestComponent_Traits_Platform.h>
 
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
 
 struct ImGuiContext;
 
@@ -45,6 +49,10 @@ namespace AtomSampleViewer
         
         //! Destroys and rebuilds the lattice.
         virtual void RebuildLattice();
+
+        //! Brings the lattice up to date with its current dimensions, spacing and scale. Only the instances of cells that were added
+        //! or removed are created or destroyed when the subclass supports incremental updates, otherwise the lattice is rebuilt.
+        void UpdateLattice();
         
         void SetLatticeMaxDimension(uint32_t max);
         void SetLatticeDimensions(uint32_t width, uint32_t depth, uint32_t height);
@@ -55,12 +63,16 @@ namespace AtomSampleViewer
 
     private:
 
-        //! Called once before CreateLatticeInstance() is called for each instance so the subclass can prepare for the total number of instances.
+        //! Called once before the instances are created so the subclass can prepare for the total number of instances.
         virtual void PrepareCreateLatticeInstances(uint32_t instanceCount) = 0;
 
-        //! This is called for each entity in the lattice when it is being built. The subclass should attach
-        //! whatever components are necessary to achieve the desired result.
-        virtual void CreateLatticeInstance(const AZ::Transform& transform) = 0;
+        //! This is called with the transforms of all the entities in the lattice when it is being built, so the subclass can
+        //! create them in batches. The default implementation calls CreateLatticeInstance() for each transform.
+        virtual void CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms);
+
+        //! This is called for each entity in the lattice when it is being built, unless the subclass overrides CreateLatticeInstances().
+        //! The subclass should attach whatever components are necessary to achieve the desired result.
+        virtual void CreateLatticeInstance(const AZ::Transform& transform);
 
         //! This is called after all the instances are created to any final work. Not required.
         virtual void FinalizeLatticeInstances() {};
@@ -68,9 +80,30 @@ namespace AtomSampleViewer
         //! Called when the subclass should destroy all of its instances, either because of shutdown or recreation.
         virtual void DestroyLatticeInstances() = 0;
 
+        //! Subclasses that override UpdateLatticeInstances() return true so UpdateLattice() doesn't rebuild the whole lattice.
+        virtual bool SupportsIncrementalLatticeUpdates() const { return false; }
+
+        //! Called by UpdateLattice() instead of rebuilding the lattice. Instances are identified by their cell's index in build order.
+        //! @param previousIndices for each cell of the new lattice, the index of the same cell in the previous lattice, or
+        //!        InvalidCellIndex for a new cell. Instances of previous cells that aren't referenced must be destroyed.
+        //! @param transforms the transforms of every cell of the new lattice.
+        //! @param transformsChanged true if the spacing or scale changed, so the kept instances need their transforms updated too.
+        virtual void UpdateLatticeInstances(
+            [[maybe_unused]] AZStd::span<const uint32_t> previousIndices,
+            [[maybe_unused]] AZStd::span<const AZ::Transform> transforms,
+            [[maybe_unused]] bool transformsChanged) {}
+
         void BuildLattice();
 
+        void UpdateLatticeAabb();
+        void SaveBuiltLatticeSettings();
+
+        //! Fills m_latticeTransforms in x, y, z order, splitting the work into jobs for large lattices.
+        void BuildLatticeTransforms();
+
     protected:
+        static constexpr uint32_t InvalidCellIndex = AZStd::numeric_limits<uint32_t>::max();
+
         //! Contains the world space Aabb of the lattice positions. Doesn't include the mesh Aabb at each position.
         AZ::Aabb m_worldAabb;
 
@@ -86,6 +119,22 @@ namespace AtomSampleViewer
         float m_spacingZ = 5.0f;
 
         float m_entityScale = 1.0f;
+
+        //! Kept between rebuilds so resizing the lattice doesn't reallocate
+        AZStd::vector<AZ::Transform> m_latticeTransforms;
+
+        //! The settings the instances were last built with, to find what changed in UpdateLattice()
+        struct BuiltLatticeSettings
+        {
+            int32_t m_width = 0;
+            int32_t m_height = 0;
+            int32_t m_depth = 0;
+            float m_spacingX = 0.0f;
+            float m_spacingY = 0.0f;
+            float m_spacingZ = 0.0f;
+            float m_entityScale = 0.0f;
+        };
+        BuiltLatticeSettings m_builtSettings;
         
         Utils::DefaultIBL m_defaultIbl;
     };
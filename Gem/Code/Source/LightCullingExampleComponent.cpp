@@ -107,6 +107,13 @@ namespace AtomSampleViewer
     {
         GetFeatureProcessors();
 
+        BenchmarkHarness::Config benchmarkConfig;
+        benchmarkConfig.m_name = "Light Culling";
+        benchmarkConfig.m_outputName = "lightCulling";
+        benchmarkConfig.m_cameraEntityId = GetCameraEntityId();
+        m_benchmarkHarness.ActivateIfRequested(benchmarkConfig);
+        m_benchmarkHarness.BenchmarkLoadStart();
+
         // Don't continue the script until after the models have loaded and lights have been created. 
         // Use a large timeout because of how slow this level loads in debug mode.
         ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::PauseScriptWithTimeout, 120.0f);
@@ -164,6 +171,8 @@ namespace AtomSampleViewer
 
         AZ::TickBus::Handler::BusDisconnect();
 
+        m_benchmarkHarness.Deactivate();
+
         m_imguiSidebar.Deactivate();
 
         RestoreCameraConfiguration();
@@ -177,8 +186,10 @@ namespace AtomSampleViewer
         DestroyLightsAndDecals();
     }
 
-    void LightCullingExampleComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint timePoint)
+    void LightCullingExampleComponent::OnTick(float deltaTime, AZ::ScriptTimePoint timePoint)
     {
+        m_benchmarkHarness.Tick(deltaTime, timePoint);
+
         if (m_worldModelAssetLoaded)
         {
             CalculateSmoothedFPS(deltaTime);
@@ -210,6 +221,8 @@ namespace AtomSampleViewer
         InitLightArrays();
         CreateLightsAndDecals();
         MoveCameraToStartPosition();
+
+        m_benchmarkHarness.BenchmarkLoadEnd();
     }
 
     void LightCullingExampleComponent::SaveCameraConfiguration()
@@ -16,6 +16,7 @@
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/Math/Random.h>
+#include <Utils/BenchmarkHarness.h>
 #include <Utils/ImGuiSidebar.h>
 
 #include <Atom/Feature/CoreLights/DiskLightFeatureProcessorInterface.h>
@@ -196,6 +197,8 @@ namespace AtomSampleViewer
         AZ::Aabb m_worldModelAABB;
         AZ::SimpleLcgRandom m_random;
 
+        BenchmarkHarness m_benchmarkHarness;
+
         ImGuiSidebar m_imguiSidebar;
 
         float m_smoothedFPS = 0.0f;
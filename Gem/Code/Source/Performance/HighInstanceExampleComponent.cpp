@@ -18,9 +18,15 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 
+#include <Automation/ScriptableImGui.h>
 #include <Automation/ScriptRunnerBus.h>
 
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Windowing/WindowBus.h>
 
 #include <RHI/BasicRHIComponent.h>
@@ -46,6 +52,9 @@ namespace AtomSampleViewer
         : m_materialBrowser("@user@/HighInstanceTestComponent/material_browser.xml")
         , m_modelBrowser("@user@/HighInstanceTestComponent/model_browser.xml")
         , m_imguiSidebar("@user@/HighInstanceTestComponent/sidebar.xml")
+        , m_transformComposeTimer(TransformTimerQueueSize, TransformTimerQueueSize)
+        , m_transformSubmitTimer(TransformTimerQueueSize, TransformTimerQueueSize)
+        , m_meshChurnTimer(TransformTimerQueueSize, TransformTimerQueueSize)
     {
         m_materialBrowser.SetFilter([](const AZ::Data::AssetInfo& assetInfo)
         {
@@ -113,6 +122,15 @@ namespace AtomSampleViewer
             m_testParameters.m_latticeSpacing[2]);
         SetLatticeEntityScale(m_testParameters.m_entityScale);
 
+        BenchmarkHarness::Config benchmarkConfig;
+        benchmarkConfig.m_name = m_sampleName.empty() ? "HighInstanceTest" : m_sampleName;
+        benchmarkConfig.m_outputName = benchmarkConfig.m_name;
+        benchmarkConfig.m_cameraEntityId = GetCameraEntityId();
+        m_benchmarkHarness.ActivateIfRequested(benchmarkConfig);
+
+        // Loading ends in OnAllAssetsReadyActivate() once the lattice's assets are ready
+        m_benchmarkHarness.BenchmarkLoadStart();
+
         Base::Activate();
 
         AzFramework::NativeWindowHandle windowHandle = nullptr;
@@ -154,6 +172,7 @@ namespace AtomSampleViewer
         m_modelBrowser.Deactivate();
 
         AZ::TickBus::Handler::BusDisconnect();
+        m_benchmarkHarness.Deactivate();
         m_imguiSidebar.Deactivate();
         Base::Deactivate();
     }
@@ -161,16 +180,22 @@ namespace AtomSampleViewer
     void HighInstanceTestComponent::PrepareCreateLatticeInstances(uint32_t instanceCount)
     {
         m_modelInstanceData.reserve(instanceCount);
+        m_instanceTransforms.Reserve(instanceCount);
         DestroyLights();
     }
 
-    void HighInstanceTestComponent::CreateLatticeInstance(const AZ::Transform& transform)
+    void HighInstanceTestComponent::CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms)
     {
-        m_modelInstanceData.emplace_back<ModelInstanceData>({});
-        ModelInstanceData& data = m_modelInstanceData.back();
-        data.m_modelAssetId = GetRandomModelId();
-        data.m_materialAssetId = GetRandomMaterialId();
-        data.m_transform = transform;
+        const size_t firstInstance = m_modelInstanceData.size();
+        m_modelInstanceData.resize(firstInstance + transforms.size());
+
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            ModelInstanceData& data = m_modelInstanceData[firstInstance + i];
+            data.m_modelAssetId = GetRandomModelId();
+            data.m_materialAssetId = GetRandomMaterialId();
+            m_instanceTransforms.PushBack(transforms[i]);
+        }
     }
 
     void HighInstanceTestComponent::FinalizeLatticeInstances()
@@ -211,6 +236,97 @@ namespace AtomSampleViewer
         ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::PauseScriptWithTimeout, 120.0f);
         AZ::TickBus::Handler::BusDisconnect();
 
+        CreateLights();
+    }
+
+    void HighInstanceTestComponent::UpdateLatticeInstances(
+        AZStd::span<const uint32_t> previousIndices, AZStd::span<const AZ::Transform> transforms, bool transformsChanged)
+    {
+        AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor = GetMeshFeatureProcessor();
+
+        // Release the meshes of the cells that don't exist anymore
+        AZStd::vector<bool> isKept(m_modelInstanceData.size(), false);
+        for (uint32_t previousIndex : previousIndices)
+        {
+            if (previousIndex != InvalidCellIndex)
+            {
+                isKept[previousIndex] = true;
+            }
+        }
+
+        for (size_t i = 0; i < m_modelInstanceData.size(); ++i)
+        {
+            if (!isKept[i])
+            {
+                meshFeatureProcessor->ReleaseMesh(m_modelInstanceData[i].m_meshHandle);
+            }
+        }
+
+        // New cells only use assets that the lattice already loaded, so they can be acquired right away without a preload
+        AZStd::vector<AZ::Data::AssetId> cachedModelIds;
+        cachedModelIds.reserve(m_modelAssets.size());
+        for (const auto& [assetId, modelAsset] : m_modelAssets)
+        {
+            cachedModelIds.push_back(assetId);
+        }
+
+        AZStd::vector<AZ::Data::AssetId> cachedMaterialIds;
+        cachedMaterialIds.reserve(m_materialInstances.size());
+        for (const auto& [assetId, materialInstance] : m_materialInstances)
+        {
+            cachedMaterialIds.push_back(assetId);
+        }
+
+        // Move the kept instances to their new index and add the new cells
+        AZStd::vector<ModelInstanceData> previousInstanceData = AZStd::move(m_modelInstanceData);
+        m_modelInstanceData.clear();
+        m_modelInstanceData.reserve(previousIndices.size());
+        m_instanceTransforms.Clear();
+        m_instanceTransforms.Reserve(previousIndices.size());
+
+        for (size_t i = 0; i < previousIndices.size(); ++i)
+        {
+            if (previousIndices[i] != InvalidCellIndex)
+            {
+                m_modelInstanceData.push_back(AZStd::move(previousInstanceData[previousIndices[i]]));
+                if (transformsChanged)
+                {
+                    meshFeatureProcessor->SetTransform(m_modelInstanceData.back().m_meshHandle, transforms[i]);
+                }
+            }
+            else
+            {
+                m_modelInstanceData.emplace_back();
+                ModelInstanceData& data = m_modelInstanceData.back();
+                if (!cachedModelIds.empty())
+                {
+                    data.m_modelAssetId = cachedModelIds[rand() % cachedModelIds.size()];
+                }
+                if (!cachedMaterialIds.empty())
+                {
+                    data.m_materialAssetId = cachedMaterialIds[rand() % cachedMaterialIds.size()];
+                }
+            }
+            m_instanceTransforms.PushBack(transforms[i]);
+        }
+
+        // New cells, and kept cells whose mesh was removed by the mesh churn, get a mesh now that their transform is known
+        for (size_t i = 0; i < m_modelInstanceData.size(); ++i)
+        {
+            if (!m_modelInstanceData[i].m_meshHandle.IsValid())
+            {
+                AcquireInstanceMesh(i);
+            }
+        }
+
+        ResetChurn();
+
+        DestroyLights();
+        CreateLights();
+    }
+
+    void HighInstanceTestComponent::CreateLights()
+    {
         if (m_testParameters.m_numShadowCastingSpotLights > 0 && m_diskLightsEnabled)
         {
             CreateSpotLights();
@@ -224,28 +340,17 @@ namespace AtomSampleViewer
 
     void HighInstanceTestComponent::OnAllAssetsReadyActivate()
     {
-        for (ModelInstanceData& instanceData : m_modelInstanceData)
-        {
-            AZ::Data::Instance<AZ::RPI::Material> materialInstance;
-            if (instanceData.m_materialAssetId.IsValid())
-            {
-                AZ::Data::Asset<RPI::MaterialAsset> materialAsset;
-                materialAsset.Create(instanceData.m_materialAssetId);
-                materialInstance = AZ::RPI::Material::FindOrCreate(materialAsset);
+        m_materialInstances.clear();
+        m_modelAssets.clear();
 
-                // cache the material when its loaded
-                m_cachedMaterials.insert(materialAsset);
-            }
+        for (size_t instanceIndex = 0; instanceIndex < m_modelInstanceData.size(); ++instanceIndex)
+        {
+            AcquireInstanceMesh(instanceIndex);
+        }
 
-            if (instanceData.m_modelAssetId.IsValid())
-            {
-                AZ::Data::Asset<AZ::RPI::ModelAsset> modelAsset;
-                modelAsset.Create(instanceData.m_modelAssetId);
+        ResetChurn();
 
-                instanceData.m_meshHandle = GetMeshFeatureProcessor()->AcquireMesh(AZ::Render::MeshHandleDescriptor(modelAsset, materialInstance));
-                GetMeshFeatureProcessor()->SetTransform(instanceData.m_meshHandle, instanceData.m_transform);
-            }
-        }
+        m_benchmarkHarness.BenchmarkLoadEnd();
 
         ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ResumeScript);
         AZ::TickBus::Handler::BusConnect();
@@ -255,6 +360,11 @@ namespace AtomSampleViewer
     {
         DestroyHandles();
         m_modelInstanceData.clear();
+        m_instanceTransforms.Clear();
+        m_materialInstances.clear();
+        m_modelAssets.clear();
+        m_churnOrder.clear();
+        m_churnIndices.clear();
     }
 
     void HighInstanceTestComponent::DestroyLights()
@@ -276,6 +386,101 @@ namespace AtomSampleViewer
             GetMeshFeatureProcessor()->ReleaseMesh(instanceData.m_meshHandle);
             instanceData.m_meshHandle = {};
         }
+        m_releasedInstances.clear();
+    }
+
+    void HighInstanceTestComponent::AcquireInstanceMesh(size_t instanceIndex)
+    {
+        ModelInstanceData& instanceData = m_modelInstanceData[instanceIndex];
+
+        AZ::Data::Instance<AZ::RPI::Material> materialInstance;
+        if (instanceData.m_materialAssetId.IsValid())
+        {
+            auto [materialIter, inserted] = m_materialInstances.try_emplace(instanceData.m_materialAssetId);
+            if (inserted)
+            {
+                AZ::Data::Asset<RPI::MaterialAsset> materialAsset;
+                materialAsset.Create(instanceData.m_materialAssetId);
+                materialIter->second = AZ::RPI::Material::FindOrCreate(materialAsset);
+
+                // cache the material when its loaded
+                m_cachedMaterials.insert(materialAsset);
+            }
+            materialInstance = materialIter->second;
+        }
+
+        if (instanceData.m_modelAssetId.IsValid())
+        {
+            auto [modelIter, inserted] = m_modelAssets.try_emplace(instanceData.m_modelAssetId);
+            if (inserted)
+            {
+                modelIter->second.Create(instanceData.m_modelAssetId);
+            }
+
+            instanceData.m_meshHandle = GetMeshFeatureProcessor()->AcquireMesh(AZ::Render::MeshHandleDescriptor(modelIter->second, materialInstance));
+            GetMeshFeatureProcessor()->SetTransform(instanceData.m_meshHandle, m_instanceTransforms.Get(instanceIndex));
+        }
+    }
+
+    void HighInstanceTestComponent::ResetChurn()
+    {
+        const uint32_t instanceCount = aznumeric_cast<uint32_t>(m_modelInstanceData.size());
+
+        m_churnOrder.resize(instanceCount);
+        for (uint32_t i = 0; i < instanceCount; ++i)
+        {
+            m_churnOrder[i] = i;
+        }
+
+        m_churnRandom.SetSeed(ChurnSeed);
+        for (uint32_t i = instanceCount; i > 1; --i)
+        {
+            AZStd::swap(m_churnOrder[i - 1], m_churnOrder[m_churnRandom.GetRandom() % i]);
+        }
+
+        m_meshRemoveCursor = 0;
+        m_releasedInstances.clear();
+        UpdateChurnIndices();
+    }
+
+    void HighInstanceTestComponent::UpdateChurnIndices()
+    {
+        const float fraction = AZ::GetClamp(m_testParameters.m_transformChurnPercent, 0.0f, 100.0f) / 100.0f;
+        const size_t churnCount = static_cast<size_t>(fraction * static_cast<float>(m_churnOrder.size()) + 0.5f);
+
+        // A prefix of the same permutation, so a higher percentage only adds instances to the subset
+        m_churnIndices.assign(m_churnOrder.begin(), m_churnOrder.begin() + churnCount);
+        AZStd::sort(m_churnIndices.begin(), m_churnIndices.end());
+    }
+
+    void HighInstanceTestComponent::ChurnMeshes()
+    {
+        AZ_PROFILE_FUNCTION(AtomSampleViewer);
+
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+
+        // Adds go first so meshes released this frame stay released for at least one frame
+        for (int i = 0; i < m_testParameters.m_meshAddsPerFrame && !m_releasedInstances.empty(); ++i)
+        {
+            AcquireInstanceMesh(m_releasedInstances.front());
+            m_releasedInstances.pop_front();
+        }
+
+        for (int i = 0; i < m_testParameters.m_meshRemovesPerFrame && !m_churnOrder.empty(); ++i)
+        {
+            const uint32_t instanceIndex = m_churnOrder[m_meshRemoveCursor];
+            m_meshRemoveCursor = (m_meshRemoveCursor + 1) % m_churnOrder.size();
+
+            ModelInstanceData& instanceData = m_modelInstanceData[instanceIndex];
+            if (instanceData.m_meshHandle.IsValid())
+            {
+                GetMeshFeatureProcessor()->ReleaseMesh(instanceData.m_meshHandle);
+                m_releasedInstances.push_back(instanceIndex);
+            }
+        }
+
+        m_meshChurnTimer.PushValue(timer.GetDeltaTimeInSeconds() * 1'000'000);
     }
 
     AZ::Data::AssetId HighInstanceTestComponent::GetRandomModelId() const
@@ -309,10 +514,12 @@ namespace AtomSampleViewer
     }
 
 
-    void HighInstanceTestComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint scriptTime)
+    void HighInstanceTestComponent::OnTick(float deltaTime, AZ::ScriptTimePoint scriptTime)
     {
 		AZ_PROFILE_FUNCTION(AtomSampleViewer);
 
+        m_benchmarkHarness.Tick(deltaTime, scriptTime);
+
         if (m_updateTransformEnabled)
         {
             float radians = static_cast<float>(fmod(scriptTime.GetSeconds(), AZ::Constants::TwoPi));
@@ -320,10 +527,12 @@ namespace AtomSampleViewer
             AZ::Transform rotationTransform;
             rotationTransform.SetFromEulerRadians(rotation);
 
-            for (ModelInstanceData& instanceData : m_modelInstanceData)
-            {
-                GetMeshFeatureProcessor()->SetTransform(instanceData.m_meshHandle, instanceData.m_transform * rotationTransform);
-            }
+            UpdateInstanceTransforms(rotationTransform.GetRotation());
+        }
+
+        if (m_testParameters.m_meshAddsPerFrame > 0 || m_testParameters.m_meshRemovesPerFrame > 0)
+        {
+            ChurnMeshes();
         }
 
         bool currentUseSimpleModels = m_useSimpleModels;
@@ -331,7 +540,50 @@ namespace AtomSampleViewer
         bool directionalLightEnabled = m_directionalLightEnabled;
         if (m_imguiSidebar.Begin())
         {
-            ImGui::Checkbox("Update Transforms Every Frame", &m_updateTransformEnabled);
+            ScriptableImGui::Checkbox("Update Transforms Every Frame", &m_updateTransformEnabled);
+
+            ImGuiHistogramQueue::WidgetSettings timerSettings;
+            timerSettings.m_units = "microseconds";
+
+            if (m_updateTransformEnabled)
+            {
+                ImGui::Text("Transform Churn %%");
+                if (ScriptableImGui::SliderFloat("##TransformChurnPercent", &m_testParameters.m_transformChurnPercent, 0.0f, 100.0f, "%.1f"))
+                {
+                    UpdateChurnIndices();
+                }
+
+                const size_t churnCount = m_churnIndices.size();
+                ImGui::Text("%zu of %zu instances animated", churnCount, m_modelInstanceData.size());
+
+                ImGui::Text("Transform Compose Time:");
+                m_transformComposeTimer.Tick(deltaTime, timerSettings);
+
+                ImGui::Text("Transform Submit Time:");
+                m_transformSubmitTimer.Tick(deltaTime, timerSettings);
+
+                if (churnCount > 0)
+                {
+                    const float costPerInstance = (m_transformComposeTimer.GetDisplayedAverage() + m_transformSubmitTimer.GetDisplayedAverage()) / static_cast<float>(churnCount);
+                    ImGui::Text("Cost per Animated Instance: %.3f microseconds", costPerInstance);
+                }
+            }
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Spacing();
+
+            ImGui::Text("Mesh Adds per Frame");
+            ScriptableImGui::SliderInt("##MeshAddsPerFrame", &m_testParameters.m_meshAddsPerFrame, 0, MaxMeshChurnPerFrame);
+            ImGui::Text("Mesh Removes per Frame");
+            ScriptableImGui::SliderInt("##MeshRemovesPerFrame", &m_testParameters.m_meshRemovesPerFrame, 0, MaxMeshChurnPerFrame);
+
+            if (m_testParameters.m_meshAddsPerFrame > 0 || m_testParameters.m_meshRemovesPerFrame > 0)
+            {
+                ImGui::Text("%zu instances without a mesh", m_releasedInstances.size());
+                ImGui::Text("Mesh Add/Remove Time:");
+                m_meshChurnTimer.Tick(deltaTime, timerSettings);
+            }
 
             ImGui::Spacing();
             ImGui::Separator();
@@ -370,14 +622,7 @@ namespace AtomSampleViewer
         if(diskLightsEnabled != m_diskLightsEnabled || directionalLightEnabled != m_directionalLightEnabled)
         {
             DestroyLights();
-            if (m_testParameters.m_numShadowCastingSpotLights > 0 && m_diskLightsEnabled)
-            {
-                CreateSpotLights();
-            }
-            if(m_testParameters.m_activateDirectionalLight && m_directionalLightEnabled)
-            {
-                CreateDirectionalLight();
-            }
+            CreateLights();
         }
 
         if (currentUseSimpleModels != m_useSimpleModels)
@@ -395,6 +640,91 @@ namespace AtomSampleViewer
         DrawDiskLightDebugObjects();
     }
 
+    void HighInstanceTestComponent::UpdateInstanceTransforms(const AZ::Quaternion& rotation)
+    {
+        AZ_PROFILE_FUNCTION(AtomSampleViewer);
+
+        const size_t instanceCount = m_churnIndices.size();
+        m_animatedTransforms.resize(instanceCount);
+
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+
+        // Applying the rotation in each instance's local space only changes the orientation, so the translation and scale are copied as is.
+        // The quaternion product runs on the platform SIMD registers.
+        auto composeTransforms = [this, rotation](size_t first, size_t end)
+        {
+            const uint32_t* indices = m_churnIndices.data();
+            const AZ::Vector3* translations = m_instanceTransforms.m_translations.data();
+            const AZ::Quaternion* rotations = m_instanceTransforms.m_rotations.data();
+            const float* scales = m_instanceTransforms.m_scales.data();
+            AZ::Transform* output = m_animatedTransforms.data();
+
+            for (size_t i = first; i < end; ++i)
+            {
+                const uint32_t instance = indices[i];
+                output[i] = AZ::Transform(translations[instance], rotations[instance] * rotation, scales[instance]);
+            }
+        };
+
+        if (instanceCount <= InstancesPerTransformJob)
+        {
+            composeTransforms(0, instanceCount);
+        }
+        else
+        {
+            AZ::JobCompletion completion;
+            for (size_t first = 0; first < instanceCount; first += InstancesPerTransformJob)
+            {
+                const size_t end = AZStd::min(first + InstancesPerTransformJob, instanceCount);
+                AZ::Job* job = AZ::CreateJobFunction([&composeTransforms, first, end]()
+                    {
+                        composeTransforms(first, end);
+                    }, true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+
+        m_transformComposeTimer.PushValue(timer.StampAndGetDeltaTimeInSeconds() * 1'000'000);
+
+        // The mesh feature processor also updates ray tracing data when a transform changes, which isn't safe to do from several threads
+        AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor = GetMeshFeatureProcessor();
+        for (size_t i = 0; i < instanceCount; ++i)
+        {
+            meshFeatureProcessor->SetTransform(m_modelInstanceData[m_churnIndices[i]].m_meshHandle, m_animatedTransforms[i]);
+        }
+
+        m_transformSubmitTimer.PushValue(timer.GetDeltaTimeInSeconds() * 1'000'000);
+    }
+
+    void HighInstanceTestComponent::InstanceTransforms::Clear()
+    {
+        m_translations.clear();
+        m_rotations.clear();
+        m_scales.clear();
+    }
+
+    void HighInstanceTestComponent::InstanceTransforms::Reserve(size_t count)
+    {
+        m_translations.reserve(count);
+        m_rotations.reserve(count);
+        m_scales.reserve(count);
+    }
+
+    void HighInstanceTestComponent::InstanceTransforms::PushBack(const AZ::Transform& transform)
+    {
+        m_translations.push_back(transform.GetTranslation());
+        m_rotations.push_back(transform.GetRotation());
+        m_scales.push_back(transform.GetUniformScale());
+    }
+
+    AZ::Transform HighInstanceTestComponent::InstanceTransforms::Get(size_t index) const
+    {
+        return AZ::Transform(m_translations[index], m_rotations[index], m_scales[index]);
+    }
+
     void HighInstanceTestComponent::ResetNoClipController()
     {
         using namespace AZ;
@@ -9,12 +9,17 @@
 #pragma once
 
 #include <EntityLatticeTestComponent.h>
+#include <Utils/BenchmarkHarness.h>
 #include <Utils/ImGuiSidebar.h>
 #include <Utils/ImGuiAssetBrowser.h>
+#include <Utils/ImGuiHistogramQueue.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Quaternion.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Color.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 
 #include <Atom/Feature/CoreLights/DirectionalLightFeatureProcessorInterface.h>
@@ -47,6 +52,11 @@ namespace AtomSampleViewer
        float m_cameraHeadingDeg = -44.7f;
        float m_cameraPitchDeg = 25.0f;
        float m_iblExposure = 0.0f;
+
+       // Churn: the part of the scene that changes every frame
+       float m_transformChurnPercent = 100.0f; // Percentage of instances animated when "Update Transforms Every Frame" is on
+       int m_meshAddsPerFrame = 0;             // Mesh handles re-acquired per frame, for instances removed earlier
+       int m_meshRemovesPerFrame = 0;          // Mesh handles released per frame
    };
     class HighInstanceTestComponent
         : public EntityLatticeTestComponent
@@ -73,9 +83,12 @@ namespace AtomSampleViewer
 
         //! EntityLatticeTestComponent overrides...
         void PrepareCreateLatticeInstances(uint32_t instanceCount) override;
-        void CreateLatticeInstance(const AZ::Transform& transform) override;
+        void CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms) override;
         void FinalizeLatticeInstances() override;
         void DestroyLatticeInstances() override;
+        bool SupportsIncrementalLatticeUpdates() const override { return true; }
+        void UpdateLatticeInstances(
+            AZStd::span<const uint32_t> previousIndices, AZStd::span<const AZ::Transform> transforms, bool transformsChanged) override;
         void DestroyLights();
 
         void DestroyHandles();
@@ -85,6 +98,20 @@ namespace AtomSampleViewer
 
         void OnTick(float deltaTime, AZ::ScriptTimePoint scriptTime) override;
 
+        //! Composes new transforms for the churned instances, their stored transforms rotated by the given rotation, on the job system.
+        //! Then sends them to the mesh feature processor one at a time. The stored transforms aren't modified.
+        void UpdateInstanceTransforms(const AZ::Quaternion& rotation);
+
+        //! Acquires the mesh of an instance, resolving its model and material through the caches shared by all instances.
+        void AcquireInstanceMesh(size_t instanceIndex);
+
+        //! Shuffles the instance indices with a fixed seed, so the churned subsets are the same from frame to frame and run to run.
+        void ResetChurn();
+        void UpdateChurnIndices();
+
+        //! Releases and re-acquires mesh handles according to the per-frame add and remove counts.
+        void ChurnMeshes();
+
         void ResetNoClipController();
         void SaveCameraConfiguration();
         void RestoreCameraConfiguration();
@@ -98,23 +125,65 @@ namespace AtomSampleViewer
 
         void CreateDirectionalLight();
 
+        //! Creates the lights that are enabled, placed around the lattice bounds.
+        void CreateLights();
+
     protected:
         HighInstanceTestParameters m_testParameters;
 
     private:
         struct ModelInstanceData
         {
-            AZ::Transform m_transform;
             AZ::Data::AssetId m_modelAssetId;
             AZ::Data::AssetId m_materialAssetId;
             AZ::Render::MeshFeatureProcessorInterface::MeshHandle m_meshHandle;
         };
 
+        //! The lattice transforms of the instances, stored as one array per component and indexed like m_modelInstanceData,
+        //! so the per-frame animation streams through tightly packed data.
+        struct InstanceTransforms
+        {
+            void Clear();
+            void Reserve(size_t count);
+            void PushBack(const AZ::Transform& transform);
+            AZ::Transform Get(size_t index) const;
+
+            AZStd::vector<AZ::Vector3> m_translations;
+            AZStd::vector<AZ::Quaternion> m_rotations;
+            AZStd::vector<float> m_scales;
+        };
+
+        //! Instances animated per job. Small enough to spread 100K instances over the worker threads.
+        static constexpr size_t InstancesPerTransformJob = 4096;
+
+        BenchmarkHarness m_benchmarkHarness;
+
         ImGuiSidebar m_imguiSidebar;
         ImGuiAssetBrowser m_materialBrowser;
         ImGuiAssetBrowser m_modelBrowser;
         
         AZStd::vector<ModelInstanceData> m_modelInstanceData;
+        InstanceTransforms m_instanceTransforms;
+
+        // The instances share a handful of models and materials, which are resolved once and reused for every mesh handle
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::Instance<AZ::RPI::Material>> m_materialInstances;
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::Asset<AZ::RPI::ModelAsset>> m_modelAssets;
+
+        static constexpr AZ::u64 ChurnSeed = 1234;
+        AZ::SimpleLcgRandom m_churnRandom;
+        AZStd::vector<uint32_t> m_churnOrder;           //!< Random permutation of the instance indices
+        AZStd::vector<uint32_t> m_churnIndices;         //!< The animated instances: the start of m_churnOrder, sorted for memory locality
+        size_t m_meshRemoveCursor = 0;                  //!< Position in m_churnOrder of the next mesh to release
+        AZStd::deque<uint32_t> m_releasedInstances;     //!< Instances without a mesh handle, re-acquired in the order they were released
+
+        //! The animated transforms of the current frame, kept between frames to avoid reallocating
+        AZStd::vector<AZ::Transform> m_animatedTransforms;
+
+        static constexpr AZStd::size_t TransformTimerQueueSize = 60;
+        static constexpr int MaxMeshChurnPerFrame = 10000;
+        ImGuiHistogramQueue m_transformComposeTimer;
+        ImGuiHistogramQueue m_transformSubmitTimer;
+        ImGuiHistogramQueue m_meshChurnTimer;
 
         struct Compare
         {
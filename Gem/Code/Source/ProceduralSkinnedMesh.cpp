@@ -8,13 +8,48 @@
 
 #include <ProceduralSkinnedMesh.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
 #include <Atom/RPI.Reflect/Model/ModelAssetHelpers.h>
 
 const uint32_t maxInfluencesPerVertex = 4;
 
 namespace AtomSampleViewer
 {
+    //! Meshes with more vertices than this are filled in parallel, in batches of about this many vertices
+    static constexpr uint32_t VerticesPerJob = 16 * 1024;
+
+    //! Copies the ring positions to the output, offset to the given height.
+    //! Four vertices are 12 floats, so the height is added to them with three 4-wide adds.
+    static void StoreRingAtHeight(const float* ringPositions, float* output, uint32_t vertexCount, float height)
+    {
+        static_assert(RPI::PositionFloatsPerVert == 3, "StoreRingAtHeight expects tightly packed xyz positions");
+        using namespace AZ::Simd;
+
+        const Vec4::FloatType heightOffset0 = Vec4::LoadImmediate(0.0f, 0.0f, height, 0.0f);
+        const Vec4::FloatType heightOffset1 = Vec4::LoadImmediate(0.0f, height, 0.0f, 0.0f);
+        const Vec4::FloatType heightOffset2 = Vec4::LoadImmediate(height, 0.0f, 0.0f, height);
+
+        uint32_t vertexIndex = 0;
+        for (; vertexIndex + 4 <= vertexCount; vertexIndex += 4)
+        {
+            const float* source = ringPositions + vertexIndex * 3;
+            float* destination = output + vertexIndex * 3;
+            Vec4::StoreUnaligned(destination + 0, Vec4::Add(Vec4::LoadUnaligned(source + 0), heightOffset0));
+            Vec4::StoreUnaligned(destination + 4, Vec4::Add(Vec4::LoadUnaligned(source + 4), heightOffset1));
+            Vec4::StoreUnaligned(destination + 8, Vec4::Add(Vec4::LoadUnaligned(source + 8), heightOffset2));
+        }
+
+        for (; vertexIndex < vertexCount; ++vertexIndex)
+        {
+            output[vertexIndex * 3 + 0] = ringPositions[vertexIndex * 3 + 0];
+            output[vertexIndex * 3 + 1] = ringPositions[vertexIndex * 3 + 1];
+            output[vertexIndex * 3 + 2] = height;
+        }
+    }
+
     void ProceduralSkinnedMesh::Resize(SkinnedMeshConfig& skinnedMeshConfig)
     {
         m_verticesPerSegment = skinnedMeshConfig.m_verticesPerSegment;
@@ -92,11 +127,106 @@ namespace AtomSampleViewer
         }
     }
 
+    void ProceduralSkinnedMesh::CalculateAnimatedBoneTransforms(const float* times, uint32_t instanceCount, bool useOutOfSyncBoneAnimation, float* output) const
+    {
+        using namespace AZ::Simd;
+
+        // This follows UpdateAnimation(), with the bones of four instances in the lanes of each vector
+        const Vec4::FloatType pi = Vec4::Splat(AZ::Constants::Pi);
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+        const uint32_t floatsPerInstance = m_boneCount * FloatsPerBoneTransform;
+
+        for (uint32_t firstInstance = 0; firstInstance < instanceCount; firstInstance += 4)
+        {
+            const uint32_t laneCount = AZ::GetMin(4u, instanceCount - firstInstance);
+
+            // Use the remainder of time/1000 to avoid floating point issues below that occur because time can be a large number
+            alignas(16) float laneTimes[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            for (uint32_t lane = 0; lane < laneCount; ++lane)
+            {
+                laneTimes[lane] = fmodf(times[firstInstance + lane], 1000.0f);
+            }
+            const Vec4::FloatType time = Vec4::LoadAligned(laneTimes);
+
+            Vec4::FloatType previousX = Vec4::ZeroFloat();
+            Vec4::FloatType previousZ = Vec4::ZeroFloat();
+            for (uint32_t boneIndex = 0; boneIndex < m_boneCount; ++boneIndex)
+            {
+                // The lower bones move a little in advance of the upper bones
+                const float boneOffset = static_cast<float>(m_boneCount - 1 - boneIndex) / static_cast<float>(m_boneCount - 1);
+                const Vec4::FloatType boneTime = useOutOfSyncBoneAnimation
+                    ? Vec4::Mul(time, Vec4::Splat(1.0f + boneOffset))
+                    : Vec4::Add(time, Vec4::Splat(boneOffset));
+
+                // Oscillate from 0 to Pi and back again
+                const Vec4::FloatType angle = Vec4::Mul(Vec4::Madd(Vec4::Cos(boneTime), pi, pi), half);
+
+                Vec4::FloatType sinAngle;
+                Vec4::FloatType cosAngle;
+                Vec4::SinCos(angle, sinAngle, cosAngle);
+
+                const Vec4::FloatType boneHeight = Vec4::Splat(m_boneHeights[boneIndex]);
+                const Vec4::FloatType x = Vec4::Mul(cosAngle, boneHeight);
+                const Vec4::FloatType z = Vec4::Mul(sinAngle, boneHeight);
+
+                // UpdateAnimation() rotates the bone around the y-axis by HalfPi - boneRotationAngle, where boneRotationAngle is the angle of
+                // the bone's direction in the xz-plane. The cosine and sine of that rotation are the z and x of the normalized direction.
+                Vec4::FloatType rotationCos = sinAngle;
+                Vec4::FloatType rotationSin = cosAngle;
+                if (boneIndex > 0 && !useOutOfSyncBoneAnimation)
+                {
+                    // For bones besides the first one, point away from the previous
+                    const Vec4::FloatType directionX = Vec4::Sub(x, previousX);
+                    const Vec4::FloatType directionZ = Vec4::Sub(z, previousZ);
+                    const Vec4::FloatType length = Vec4::Sqrt(Vec4::Madd(directionX, directionX, Vec4::Mul(directionZ, directionZ)));
+                    rotationCos = Vec4::Div(directionZ, length);
+                    rotationSin = Vec4::Div(directionX, length);
+                }
+                previousX = x;
+                previousZ = z;
+
+                alignas(16) float laneX[4];
+                alignas(16) float laneZ[4];
+                alignas(16) float laneCos[4];
+                alignas(16) float laneSin[4];
+                Vec4::StoreAligned(laneX, x);
+                Vec4::StoreAligned(laneZ, z);
+                Vec4::StoreAligned(laneCos, rotationCos);
+                Vec4::StoreAligned(laneSin, rotationSin);
+
+                for (uint32_t lane = 0; lane < laneCount; ++lane)
+                {
+                    // Row-major rotation around the y-axis, with the translation in the last column
+                    float* boneTransform = output + (firstInstance + lane) * floatsPerInstance + boneIndex * FloatsPerBoneTransform;
+                    boneTransform[0] = laneCos[lane];
+                    boneTransform[1] = 0.0f;
+                    boneTransform[2] = laneSin[lane];
+                    boneTransform[3] = laneX[lane];
+                    boneTransform[4] = 0.0f;
+                    boneTransform[5] = 1.0f;
+                    boneTransform[6] = 0.0f;
+                    boneTransform[7] = 0.0f;
+                    boneTransform[8] = -laneSin[lane];
+                    boneTransform[9] = 0.0f;
+                    boneTransform[10] = laneCos[lane];
+                    boneTransform[11] = laneZ[lane];
+                }
+            }
+        }
+    }
+
     uint32_t ProceduralSkinnedMesh::GetInfluencesPerVertex() const
     {
         return m_influencesPerVertex;
     }
 
+    uint32_t ProceduralSkinnedMesh::GetBlendIndex(uint32_t vertexIndex, uint32_t influenceIndex) const
+    {
+        // Two ids are packed into each uint32, with the first/even id in the most significant bits
+        const uint32_t packed = m_blendIndices[vertexIndex * m_influencesPerVertex / 2 + influenceIndex / 2];
+        return influenceIndex % 2 == 0 ? packed >> 16 : packed & 0xFFFF;
+    }
+
     uint32_t ProceduralSkinnedMesh::GetSubMeshCount() const
     {
         return m_subMeshCount;
@@ -113,28 +243,6 @@ namespace AtomSampleViewer
         // There are 6 indices per-side, and one fewer side than vertices per side since the first/last vertex in the segment have the same position (but different uvs)
         // Exclude one segment in the count because you need a second segment in order to make triangles between them
         m_indices.resize(6 * (m_verticesPerSegment - 1) * (m_segmentCount - 1));
-        uint32_t currentIndex = 0;
-        // For each segment (except for the last one), create triangles with the segment above it
-        for (uint32_t segmentIndex = 0; segmentIndex < m_segmentCount - 1; ++segmentIndex)
-        {
-            for (uint32_t sideIndex = 0; sideIndex < m_verticesPerSegment - 1; ++sideIndex)
-            {
-                // Each side has four vertices
-                uint32_t bottomLeft = segmentIndex * m_verticesPerSegment + sideIndex;
-                uint32_t bottomRight = segmentIndex * m_verticesPerSegment + sideIndex + 1;
-                uint32_t topLeft = (segmentIndex + 1) * m_verticesPerSegment + sideIndex;
-                uint32_t topRight = (segmentIndex + 1) * m_verticesPerSegment + sideIndex + 1;
-
-                // Each side has two triangles, using a right handed coordinate system
-                m_indices[currentIndex++] = bottomLeft;
-                m_indices[currentIndex++] = topRight;
-                m_indices[currentIndex++] = topLeft;
-
-                m_indices[currentIndex++] = bottomLeft;
-                m_indices[currentIndex++] = bottomRight;
-                m_indices[currentIndex++] = topRight;
-            }
-        }
 
         m_positions.resize(m_alignedVertCountForRGBStream);
         m_normals.resize(m_alignedVertCountForRGBStream);
@@ -153,72 +261,140 @@ namespace AtomSampleViewer
 
         m_uvs.resize(m_vertexCount);
 
-        for (uint32_t vertexIndex = 0; vertexIndex < m_vertexCount; ++vertexIndex)
-        {
-            // Vertices circle around the origin counter-clockwise, then move up one segment and do it again.
-            uint32_t indexWithinTheCurrentSegment = vertexIndex % m_verticesPerSegment;
-            uint32_t segmentIndex = vertexIndex / m_verticesPerSegment;
-
-            // Get the x and y positions from a unit circle
-            float vertexAngle = (AZ::Constants::TwoPi / static_cast<float>(m_verticesPerSegment - 1)) * static_cast<float>(indexWithinTheCurrentSegment);
-            m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 0] = cosf(vertexAngle) * m_radius;
-            m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 1] = sinf(vertexAngle) * m_radius;
-            m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 2] = m_segmentHeightOffsets[segmentIndex];
+        CalculateRing();
 
-            // Normals are flat on the z-plane and point away from the origin in the direction of the vertex position
-            m_normals[(vertexIndex * RPI::PositionFloatsPerVert) + 0] = m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 0];
-            m_normals[(vertexIndex * RPI::PositionFloatsPerVert) + 1] = m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 1];
-            m_normals[(vertexIndex * RPI::PositionFloatsPerVert) + 2] = 0.0f;
+        // With an odd number of influences, two neighboring vertices pack their blend indices into the same uint32,
+        // so use an even number of segments per job to start every job on an even vertex
+        uint32_t segmentsPerJob = AZ::GetMax(1u, VerticesPerJob / m_verticesPerSegment);
+        segmentsPerJob += segmentsPerJob % 2;
 
-            // Bitangent is straight down
-            m_bitangents[(vertexIndex * RPI::PositionFloatsPerVert)+0] = 0.0f;
-            m_bitangents[(vertexIndex * RPI::PositionFloatsPerVert)+1] = 0.0f;
-            m_bitangents[(vertexIndex * RPI::PositionFloatsPerVert)+2] = -1.0f;
+        if (m_segmentCount <= segmentsPerJob)
+        {
+            FillSegments(0, m_segmentCount);
+            return;
+        }
 
-            for (size_t i = 0; i < m_influencesPerVertex; ++i)
-            {
-                // m_blendIndices has two id's packed into a single uint32
-                size_t packedIndex = vertexIndex * m_influencesPerVertex / 2 + i / 2;
-                // m_blendWeights has an individual weight per influence
-                size_t unpackedIndex = vertexIndex * m_influencesPerVertex + i;
-                // Blend indices/weights are the same for each vertex in the segment,
-                // so copy the source data from the segment. Both id's and weights are unpacked
-                size_t sourceIndex = segmentIndex * m_influencesPerVertex + i;
-                
-                // Pack the segment blend indices, two per 32-bit uint
-                if (i % 2 == 0)
-                {
-                    // Put the first/even ids in the most significant bits
-                    m_blendIndices[packedIndex] = m_segmentBlendIndices[sourceIndex] << 16;
-                }
-                else
+        AZ::JobCompletion completion;
+        for (uint32_t firstSegment = 0; firstSegment < m_segmentCount; firstSegment += segmentsPerJob)
+        {
+            const uint32_t endSegment = AZ::GetMin(firstSegment + segmentsPerJob, m_segmentCount);
+            AZ::Job* job = AZ::CreateJobFunction([this, firstSegment, endSegment]()
                 {
-                    // Put the next/odd ids in the least significant bits
-                    m_blendIndices[packedIndex] |= m_segmentBlendIndices[sourceIndex];
-                }
+                    FillSegments(firstSegment, endSegment);
+                }, true);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+    }
 
-                // Copy the weights
-                m_blendWeights[unpackedIndex] = m_segmentBlendWeights[sourceIndex];
-            }
+    void ProceduralSkinnedMesh::CalculateRing()
+    {
+        m_ringPositions.resize(m_verticesPerSegment * RPI::PositionFloatsPerVert);
+        m_ringTangents.resize(m_verticesPerSegment * RPI::TangentFloatsPerVert);
+        m_ringUs.resize(m_verticesPerSegment);
+
+        for (uint32_t indexWithinTheSegment = 0; indexWithinTheSegment < m_verticesPerSegment; ++indexWithinTheSegment)
+        {
+            // Vertices circle around the origin counter-clockwise. Get the x and y positions from a unit circle
+            float vertexAngle = (AZ::Constants::TwoPi / static_cast<float>(m_verticesPerSegment - 1)) * static_cast<float>(indexWithinTheSegment);
+            m_ringPositions[(indexWithinTheSegment * RPI::PositionFloatsPerVert) + 0] = cosf(vertexAngle) * m_radius;
+            m_ringPositions[(indexWithinTheSegment * RPI::PositionFloatsPerVert) + 1] = sinf(vertexAngle) * m_radius;
+            m_ringPositions[(indexWithinTheSegment * RPI::PositionFloatsPerVert) + 2] = 0.0f;
 
             // The uvs wrap around the cylinder exactly once
-            m_uvs[vertexIndex][0] = static_cast<float>(indexWithinTheCurrentSegment) / static_cast<float>(m_verticesPerSegment - 1);
-            // The uvs stretch from bottom to top
-            m_uvs[vertexIndex][1] = m_segmentHeights[segmentIndex] / m_height;
+            m_ringUs[indexWithinTheSegment] = static_cast<float>(indexWithinTheSegment) / static_cast<float>(m_verticesPerSegment - 1);
         }
 
         // Do a separate pass on the tangents, since the positions need to be known first
-        for (uint32_t vertexIndex = 0; vertexIndex < m_vertexCount; ++vertexIndex)
+        for (uint32_t leftVertex = 0; leftVertex < m_verticesPerSegment; ++leftVertex)
         {
             // Tangent for each side points horizontally from the left vertex to the right vertex of each side
-            uint32_t leftVertex = vertexIndex;
-            // The last vertex of the segment will have the first vertex of the segment as its neighbor, not just the next vertex (which would be in the next segment)
+            // The last vertex of the segment will have the first vertex of the segment as its neighbor
             uint32_t rightVertex = (leftVertex + 1) % m_verticesPerSegment;
-            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+0] = m_positions[(leftVertex * RPI::PositionFloatsPerVert) + 0] - m_positions[(rightVertex * RPI::PositionFloatsPerVert)+0];
-            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+1] = m_positions[(leftVertex * RPI::PositionFloatsPerVert) + 1] - m_positions[(rightVertex * RPI::PositionFloatsPerVert)+1];
+            m_ringTangents[(leftVertex * RPI::TangentFloatsPerVert) + 0] = m_ringPositions[(leftVertex * RPI::PositionFloatsPerVert) + 0] - m_ringPositions[(rightVertex * RPI::PositionFloatsPerVert) + 0];
+            m_ringTangents[(leftVertex * RPI::TangentFloatsPerVert) + 1] = m_ringPositions[(leftVertex * RPI::PositionFloatsPerVert) + 1] - m_ringPositions[(rightVertex * RPI::PositionFloatsPerVert) + 1];
+            m_ringTangents[(leftVertex * RPI::TangentFloatsPerVert) + 2] = 0.0f;
+            m_ringTangents[(leftVertex * RPI::TangentFloatsPerVert) + 3] = 1.0f;
+        }
+    }
+
+    void ProceduralSkinnedMesh::FillSegments(uint32_t firstSegment, uint32_t endSegment)
+    {
+        for (uint32_t segmentIndex = firstSegment; segmentIndex < endSegment; ++segmentIndex)
+        {
+            // For each segment (except for the last one), create triangles with the segment above it
+            if (segmentIndex < m_segmentCount - 1)
+            {
+                uint32_t currentIndex = 6 * (m_verticesPerSegment - 1) * segmentIndex;
+                for (uint32_t sideIndex = 0; sideIndex < m_verticesPerSegment - 1; ++sideIndex)
+                {
+                    // Each side has four vertices
+                    uint32_t bottomLeft = segmentIndex * m_verticesPerSegment + sideIndex;
+                    uint32_t bottomRight = segmentIndex * m_verticesPerSegment + sideIndex + 1;
+                    uint32_t topLeft = (segmentIndex + 1) * m_verticesPerSegment + sideIndex;
+                    uint32_t topRight = (segmentIndex + 1) * m_verticesPerSegment + sideIndex + 1;
+
+                    // Each side has two triangles, using a right handed coordinate system
+                    m_indices[currentIndex++] = bottomLeft;
+                    m_indices[currentIndex++] = topRight;
+                    m_indices[currentIndex++] = topLeft;
+
+                    m_indices[currentIndex++] = bottomLeft;
+                    m_indices[currentIndex++] = bottomRight;
+                    m_indices[currentIndex++] = topRight;
+                }
+            }
+
+            const uint32_t firstVertex = segmentIndex * m_verticesPerSegment;
 
-            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+2] = 0.0f;
-            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+3] = 1.0f;
+            // Move up to the segment's height
+            StoreRingAtHeight(m_ringPositions.data(), m_positions.data() + firstVertex * RPI::PositionFloatsPerVert, m_verticesPerSegment, m_segmentHeightOffsets[segmentIndex]);
+
+            // Normals are flat on the z-plane and point away from the origin in the direction of the vertex position
+            AZStd::copy(m_ringPositions.begin(), m_ringPositions.end(), m_normals.begin() + firstVertex * RPI::PositionFloatsPerVert);
+
+            AZStd::copy(m_ringTangents.begin(), m_ringTangents.end(), m_tangents.begin() + firstVertex * RPI::TangentFloatsPerVert);
+
+            // The uvs stretch from bottom to top
+            const float v = m_segmentHeights[segmentIndex] / m_height;
+
+            for (uint32_t vertexIndex = firstVertex; vertexIndex < firstVertex + m_verticesPerSegment; ++vertexIndex)
+            {
+                // Bitangent is straight down
+                m_bitangents[(vertexIndex * RPI::PositionFloatsPerVert)+0] = 0.0f;
+                m_bitangents[(vertexIndex * RPI::PositionFloatsPerVert)+1] = 0.0f;
+                m_bitangents[(vertexIndex * RPI::PositionFloatsPerVert)+2] = -1.0f;
+
+                for (size_t i = 0; i < m_influencesPerVertex; ++i)
+                {
+                    // m_blendIndices has two id's packed into a single uint32
+                    size_t packedIndex = vertexIndex * m_influencesPerVertex / 2 + i / 2;
+                    // m_blendWeights has an individual weight per influence
+                    size_t unpackedIndex = vertexIndex * m_influencesPerVertex + i;
+                    // Blend indices/weights are the same for each vertex in the segment,
+                    // so copy the source data from the segment. Both id's and weights are unpacked
+                    size_t sourceIndex = segmentIndex * m_influencesPerVertex + i;
+                    
+                    // Pack the segment blend indices, two per 32-bit uint
+                    if (i % 2 == 0)
+                    {
+                        // Put the first/even ids in the most significant bits
+                        m_blendIndices[packedIndex] = m_segmentBlendIndices[sourceIndex] << 16;
+                    }
+                    else
+                    {
+                        // Put the next/odd ids in the least significant bits
+                        m_blendIndices[packedIndex] |= m_segmentBlendIndices[sourceIndex];
+                    }
+
+                    // Copy the weights
+                    m_blendWeights[unpackedIndex] = m_segmentBlendWeights[sourceIndex];
+                }
+
+                m_uvs[vertexIndex][0] = m_ringUs[vertexIndex - firstVertex];
+                m_uvs[vertexIndex][1] = v;
+            }
         }
     }
 
@@ -353,6 +529,11 @@ namespace AtomSampleViewer
         }
     }
 
+    uint32_t ProceduralSkinnedMesh::GetBoneCount() const
+    {
+        return m_boneCount;
+    }
+
     uint32_t ProceduralSkinnedMesh::GetVertexCount() const
     {
         return m_vertexCount;
@@ -32,10 +32,20 @@ namespace AtomSampleViewer
         void Resize(SkinnedMeshConfig& skinnedMeshConfig);
         void UpdateAnimation(float time, bool useOutOfSyncBoneAnimation = false);
 
+        //! Animates instanceCount copies of the mesh, each at its own time, without modifying m_boneMatrices.
+        //! Writes the bone transforms of each instance as consecutive row-major float12s, the layout of the bone transform buffer,
+        //! so output needs room for instanceCount * GetBoneCount() * FloatsPerBoneTransform floats.
+        //! Four instances are animated at once with SIMD trig, so this is much faster than UpdateAnimation() for many instances.
+        void CalculateAnimatedBoneTransforms(const float* times, uint32_t instanceCount, bool useOutOfSyncBoneAnimation, float* output) const;
+        static constexpr uint32_t FloatsPerBoneTransform = 12;
+
         uint32_t GetInfluencesPerVertex() const;
+        //! Returns the bone id of one of a vertex's influences, unpacked from m_blendIndices
+        uint32_t GetBlendIndex(uint32_t vertexIndex, uint32_t influenceIndex) const;
         uint32_t GetSubMeshCount() const;
         float GetSubMeshYOffset() const;
 
+        uint32_t GetBoneCount() const;
         uint32_t GetVertexCount() const;
         uint32_t GetAlignedVertCountForRGBStream() const;
         uint32_t GetAlignedVertCountForRGBAStream() const;
@@ -57,6 +67,10 @@ namespace AtomSampleViewer
         void CalculateBones();
         void CalculateSegments();
         void CalculateVertexBuffers();
+        void CalculateRing();
+        //! Fills the indices and vertex streams of the segments in [firstSegment, endSegment). Batches of segments don't share any output elements
+        //! as long as firstSegment * m_verticesPerSegment is even, so they can be filled in parallel.
+        void FillSegments(uint32_t firstSegment, uint32_t endSegment);
 
         // Extra values that are used while generating per-vertex data
         AZStd::vector<float> m_boneHeights;
@@ -65,6 +79,11 @@ namespace AtomSampleViewer
         AZStd::vector<float> m_segmentBlendWeights;
         AZStd::vector<float> m_segmentHeightOffsets;
 
+        // Every segment is the same ring of vertices at a different height, so the ring is generated once and copied into each segment
+        AZStd::vector<float> m_ringPositions;   //!< Also the normals, since the ring is centered on the z-axis at a height of 0
+        AZStd::vector<float> m_ringTangents;
+        AZStd::vector<float> m_ringUs;
+
         uint32_t m_boneCount = 0;
         uint32_t m_vertexCount = 0;
         uint32_t m_alignedVertCountForRGBStream = 0;
@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <ProceduralSkinnedMeshCompactStreams.h>
+#include <ProceduralSkinnedMesh.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AtomSampleViewer
+{
+    namespace CompactVertexStreams
+    {
+        static constexpr uint32_t PositionFloatsPerVertex = 3;
+        static constexpr uint32_t TangentFloatsPerVertex = 4;
+        static constexpr float SnormScale = 32767.0f;
+
+        using Float3 = AZStd::array<float, 3>;
+
+        static float Dot(const Float3& a, const Float3& b)
+        {
+            return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+        }
+
+        static Float3 Cross(const Float3& a, const Float3& b)
+        {
+            return { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+        }
+
+        //! Returns false for vectors that are too short to have a direction
+        static bool Normalize(Float3& vector)
+        {
+            const float length = sqrtf(Dot(vector, vector));
+            if (length <= AZ::Constants::FloatEpsilon)
+            {
+                return false;
+            }
+            vector = { vector[0] / length, vector[1] / length, vector[2] / length };
+            return true;
+        }
+
+        static float SignNotZero(float value)
+        {
+            return value >= 0.0f ? 1.0f : -1.0f;
+        }
+
+        static int16_t ToSnorm16(float value)
+        {
+            return static_cast<int16_t>(roundf(AZ::GetClamp(value, -1.0f, 1.0f) * SnormScale));
+        }
+
+        static float FromSnorm16(int16_t value)
+        {
+            return AZ::GetMax(static_cast<float>(value) / SnormScale, -1.0f);
+        }
+
+        static uint32_t PackSnorm16x2(int16_t x, int16_t y)
+        {
+            return static_cast<uint16_t>(x) | (static_cast<uint32_t>(static_cast<uint16_t>(y)) << 16);
+        }
+
+        static void UnpackSnorm16x2(uint32_t packed, int16_t& x, int16_t& y)
+        {
+            x = static_cast<int16_t>(packed & 0xFFFF);
+            y = static_cast<int16_t>(packed >> 16);
+        }
+
+        //! Projects a unit vector onto the octahedron, and folds the lower half over the upper half to map it to [-1, 1]^2
+        static void OctahedralEncode(const Float3& direction, float& x, float& y)
+        {
+            const float l1Norm = fabsf(direction[0]) + fabsf(direction[1]) + fabsf(direction[2]);
+            x = direction[0] / l1Norm;
+            y = direction[1] / l1Norm;
+            if (direction[2] < 0.0f)
+            {
+                const float foldedX = (1.0f - fabsf(y)) * SignNotZero(x);
+                const float foldedY = (1.0f - fabsf(x)) * SignNotZero(y);
+                x = foldedX;
+                y = foldedY;
+            }
+        }
+
+        static Float3 OctahedralDecode(float x, float y)
+        {
+            Float3 direction = { x, y, 1.0f - fabsf(x) - fabsf(y) };
+            if (direction[2] < 0.0f)
+            {
+                direction[0] = (1.0f - fabsf(y)) * SignNotZero(x);
+                direction[1] = (1.0f - fabsf(x)) * SignNotZero(y);
+            }
+            Normalize(direction);
+            return direction;
+        }
+
+        static float AngleInDegrees(const Float3& a, const Float3& b)
+        {
+            return AZ::RadToDeg(acosf(AZ::GetClamp(Dot(a, b), -1.0f, 1.0f)));
+        }
+
+        static uint32_t GetWeightMax(WeightFormat weightFormat)
+        {
+            return weightFormat == WeightFormat::Unorm8 ? 0xFF : 0xFFFF;
+        }
+
+        static uint32_t GetWeightSize(WeightFormat weightFormat)
+        {
+            return weightFormat == WeightFormat::Unorm8 ? 1 : 2;
+        }
+
+        static uint32_t ReadWeight(const CompactStreams& compactStreams, size_t index)
+        {
+            if (compactStreams.m_weightFormat == WeightFormat::Unorm8)
+            {
+                return compactStreams.m_blendWeights[index];
+            }
+            return compactStreams.m_blendWeights[index * 2] | (compactStreams.m_blendWeights[index * 2 + 1] << 8);
+        }
+
+        static void WriteWeight(CompactStreams& compactStreams, size_t index, uint32_t value)
+        {
+            if (compactStreams.m_weightFormat == WeightFormat::Unorm8)
+            {
+                compactStreams.m_blendWeights[index] = static_cast<uint8_t>(value);
+            }
+            else
+            {
+                compactStreams.m_blendWeights[index * 2] = static_cast<uint8_t>(value & 0xFF);
+                compactStreams.m_blendWeights[index * 2 + 1] = static_cast<uint8_t>(value >> 8);
+            }
+        }
+
+        static Float3 ReadFloat3(const AZStd::vector<float>& stream, size_t vertexIndex, uint32_t floatsPerVertex)
+        {
+            const float* element = &stream[vertexIndex * floatsPerVertex];
+            return { element[0], element[1], element[2] };
+        }
+
+        uint16_t FloatToHalf(float value)
+        {
+            uint32_t bits = 0;
+            memcpy(&bits, &value, sizeof(bits));
+
+            const uint32_t sign = (bits >> 16) & 0x8000;
+            const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFF) - 127 + 15;
+            uint32_t mantissa = bits & 0x7FFFFF;
+
+            if (exponent <= 0)
+            {
+                // Too small for a normalized half, so it becomes a denormal or zero
+                if (exponent < -10)
+                {
+                    return static_cast<uint16_t>(sign);
+                }
+                mantissa |= 0x800000;
+                const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+                uint32_t half = mantissa >> shift;
+                if ((mantissa >> (shift - 1)) & 1)
+                {
+                    ++half;
+                }
+                return static_cast<uint16_t>(sign | half);
+            }
+
+            if (exponent >= 31)
+            {
+                return static_cast<uint16_t>(sign | 0x7C00);
+            }
+
+            // Round to nearest. A carry out of the mantissa correctly increments the exponent.
+            uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+            if (mantissa & 0x1000)
+            {
+                ++half;
+            }
+            return static_cast<uint16_t>(half);
+        }
+
+        float HalfToFloat(uint16_t value)
+        {
+            const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+            const uint32_t exponent = (value >> 10) & 0x1F;
+            const uint32_t mantissa = value & 0x3FF;
+
+            if (exponent == 0)
+            {
+                const float denormal = static_cast<float>(mantissa) / static_cast<float>(1 << 24);
+                return sign ? -denormal : denormal;
+            }
+
+            uint32_t bits = 0;
+            if (exponent == 31)
+            {
+                bits = sign | 0x7F800000 | (mantissa << 13);
+            }
+            else
+            {
+                bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+            }
+
+            float result = 0.0f;
+            memcpy(&result, &bits, sizeof(result));
+            return result;
+        }
+
+        uint32_t GetFullBytesPerVertex(uint32_t influencesPerVertex)
+        {
+            // xyz positions, normals and bitangents, xyzw tangents, 16-bit bone ids and 32-bit weights
+            return 3 * sizeof(float) * 3 + 4 * sizeof(float) + influencesPerVertex * (sizeof(uint16_t) + sizeof(float));
+        }
+
+        uint32_t GetCompactBytesPerVertex(uint32_t influencesPerVertex, WeightFormat weightFormat)
+        {
+            // Four half floats for the position, two snorm16s each for the normal and tangent, 8-bit bone ids and weights
+            return 4 * sizeof(uint16_t) + 2 * sizeof(uint32_t) + influencesPerVertex * (sizeof(uint8_t) + GetWeightSize(weightFormat));
+        }
+
+        CompactStreams Encode(const ProceduralSkinnedMesh& mesh, WeightFormat weightFormat)
+        {
+            CompactStreams compactStreams;
+            compactStreams.m_vertexCount = mesh.GetVertexCount();
+            compactStreams.m_influencesPerVertex = mesh.GetInfluencesPerVertex();
+            compactStreams.m_weightFormat = weightFormat;
+
+            const uint32_t vertexCount = compactStreams.m_vertexCount;
+            const uint32_t influenceCount = compactStreams.m_influencesPerVertex;
+            AZ_Error("CompactVertexStreams", mesh.GetBoneCount() <= 256, "%u bones don't fit in 8-bit bone ids", mesh.GetBoneCount());
+
+            // Find the bounds of the positions
+            Float3 minPosition = { AZ::Constants::FloatMax, AZ::Constants::FloatMax, AZ::Constants::FloatMax };
+            Float3 maxPosition = { -AZ::Constants::FloatMax, -AZ::Constants::FloatMax, -AZ::Constants::FloatMax };
+            for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+            {
+                const Float3 position = ReadFloat3(mesh.m_positions, vertexIndex, PositionFloatsPerVertex);
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    minPosition[axis] = AZ::GetMin(minPosition[axis], position[axis]);
+                    maxPosition[axis] = AZ::GetMax(maxPosition[axis], position[axis]);
+                }
+            }
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                compactStreams.m_positionCenter[axis] = (minPosition[axis] + maxPosition[axis]) * 0.5f;
+                // Avoid dividing by zero for flat bounds
+                compactStreams.m_positionHalfExtents[axis] = AZ::GetMax((maxPosition[axis] - minPosition[axis]) * 0.5f, AZ::Constants::FloatEpsilon);
+            }
+
+            compactStreams.m_positions.resize(vertexCount * 4);
+            compactStreams.m_normals.resize(vertexCount);
+            compactStreams.m_tangents.resize(vertexCount);
+            compactStreams.m_blendIndices.resize(vertexCount * influenceCount);
+            compactStreams.m_blendWeights.resize(vertexCount * influenceCount * GetWeightSize(weightFormat));
+
+            const uint32_t weightMax = GetWeightMax(weightFormat);
+            for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+            {
+                const Float3 position = ReadFloat3(mesh.m_positions, vertexIndex, PositionFloatsPerVertex);
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    const float relativePosition = (position[axis] - compactStreams.m_positionCenter[axis]) / compactStreams.m_positionHalfExtents[axis];
+                    compactStreams.m_positions[vertexIndex * 4 + axis] = FloatToHalf(relativePosition);
+                }
+                compactStreams.m_positions[vertexIndex * 4 + 3] = FloatToHalf(1.0f);
+
+                // Degenerate normals and tangents get an arbitrary direction
+                Float3 normal = ReadFloat3(mesh.m_normals, vertexIndex, PositionFloatsPerVertex);
+                if (!Normalize(normal))
+                {
+                    normal = { 0.0f, 0.0f, 1.0f };
+                }
+                float x = 0.0f;
+                float y = 0.0f;
+                OctahedralEncode(normal, x, y);
+                compactStreams.m_normals[vertexIndex] = PackSnorm16x2(ToSnorm16(x), ToSnorm16(y));
+
+                Float3 tangent = ReadFloat3(mesh.m_tangents, vertexIndex, TangentFloatsPerVertex);
+                if (!Normalize(tangent))
+                {
+                    tangent = { 1.0f, 0.0f, 0.0f };
+                }
+                OctahedralEncode(tangent, x, y);
+
+                // The bitangent is rebuilt from the cross product of the normal and tangent, so only its sign is stored
+                const Float3 bitangent = ReadFloat3(mesh.m_bitangents, vertexIndex, PositionFloatsPerVertex);
+                const bool isBitangentPositive = Dot(Cross(normal, tangent), bitangent) >= 0.0f;
+                const int16_t tangentY = static_cast<int16_t>((ToSnorm16(y) & ~1) | (isBitangentPositive ? 1 : 0));
+                compactStreams.m_tangents[vertexIndex] = PackSnorm16x2(ToSnorm16(x), tangentY);
+
+                // Quantize the weights, then give the rounding error to the largest weight so they still add up to exactly 1.
+                // If that would push the largest weight past 0 or 1, the rest of the error is spread over the other weights
+                uint32_t weightSum = 0;
+                uint32_t largestInfluence = 0;
+                for (uint32_t i = 0; i < influenceCount; ++i)
+                {
+                    const size_t influenceIndex = vertexIndex * influenceCount + i;
+                    compactStreams.m_blendIndices[influenceIndex] = static_cast<uint8_t>(mesh.GetBlendIndex(vertexIndex, i));
+
+                    const float weight = mesh.m_blendWeights[influenceIndex];
+                    const uint32_t quantizedWeight = static_cast<uint32_t>(roundf(AZ::GetClamp(weight, 0.0f, 1.0f) * weightMax));
+                    WriteWeight(compactStreams, influenceIndex, quantizedWeight);
+                    weightSum += quantizedWeight;
+                    if (weight > mesh.m_blendWeights[vertexIndex * influenceCount + largestInfluence])
+                    {
+                        largestInfluence = i;
+                    }
+                }
+                int32_t remainder = static_cast<int32_t>(weightMax) - static_cast<int32_t>(weightSum);
+                for (uint32_t i = 0; i < influenceCount && remainder != 0; ++i)
+                {
+                    // Start with the largest weight, then move on to the others in order
+                    const uint32_t influence = i == 0 ? largestInfluence : (i <= largestInfluence ? i - 1 : i);
+                    const size_t influenceIndex = vertexIndex * influenceCount + influence;
+                    const int32_t quantizedWeight = static_cast<int32_t>(ReadWeight(compactStreams, influenceIndex));
+                    const int32_t correctedWeight = AZ::GetClamp(quantizedWeight + remainder, 0, static_cast<int32_t>(weightMax));
+                    WriteWeight(compactStreams, influenceIndex, static_cast<uint32_t>(correctedWeight));
+                    remainder -= correctedWeight - quantizedWeight;
+                }
+            }
+
+            return compactStreams;
+        }
+
+        EncodingError Validate(const ProceduralSkinnedMesh& mesh, const CompactStreams& compactStreams)
+        {
+            EncodingError error;
+            const uint32_t influenceCount = compactStreams.m_influencesPerVertex;
+            const float weightMax = static_cast<float>(GetWeightMax(compactStreams.m_weightFormat));
+
+            for (uint32_t vertexIndex = 0; vertexIndex < compactStreams.m_vertexCount; ++vertexIndex)
+            {
+                const Float3 position = ReadFloat3(mesh.m_positions, vertexIndex, PositionFloatsPerVertex);
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    const float decodedPosition = compactStreams.m_positionCenter[axis] +
+                        HalfToFloat(compactStreams.m_positions[vertexIndex * 4 + axis]) * compactStreams.m_positionHalfExtents[axis];
+                    error.m_maxPositionError = AZ::GetMax(error.m_maxPositionError, fabsf(decodedPosition - position[axis]));
+                }
+
+                int16_t x = 0;
+                int16_t y = 0;
+                UnpackSnorm16x2(compactStreams.m_normals[vertexIndex], x, y);
+                const Float3 decodedNormal = OctahedralDecode(FromSnorm16(x), FromSnorm16(y));
+                Float3 normal = ReadFloat3(mesh.m_normals, vertexIndex, PositionFloatsPerVertex);
+                if (Normalize(normal))
+                {
+                    error.m_maxNormalErrorDegrees = AZ::GetMax(error.m_maxNormalErrorDegrees, AngleInDegrees(normal, decodedNormal));
+                }
+
+                UnpackSnorm16x2(compactStreams.m_tangents[vertexIndex], x, y);
+                const Float3 decodedTangent = OctahedralDecode(FromSnorm16(x), FromSnorm16(y));
+                Float3 tangent = ReadFloat3(mesh.m_tangents, vertexIndex, TangentFloatsPerVertex);
+                if (Normalize(tangent))
+                {
+                    error.m_maxTangentErrorDegrees = AZ::GetMax(error.m_maxTangentErrorDegrees, AngleInDegrees(tangent, decodedTangent));
+
+                    const Float3 bitangent = ReadFloat3(mesh.m_bitangents, vertexIndex, PositionFloatsPerVertex);
+                    const float bitangentSign = (y & 1) ? 1.0f : -1.0f;
+                    if (SignNotZero(Dot(Cross(decodedNormal, decodedTangent), bitangent)) != bitangentSign)
+                    {
+                        error.m_bitangentSignMismatchCount++;
+                    }
+                }
+
+                for (uint32_t i = 0; i < influenceCount; ++i)
+                {
+                    const size_t influenceIndex = vertexIndex * influenceCount + i;
+                    if (compactStreams.m_blendIndices[influenceIndex] != mesh.GetBlendIndex(vertexIndex, i))
+                    {
+                        error.m_blendIndexMismatchCount++;
+                    }
+
+                    const float decodedWeight = static_cast<float>(ReadWeight(compactStreams, influenceIndex)) / weightMax;
+                    error.m_maxWeightError = AZ::GetMax(error.m_maxWeightError, fabsf(decodedWeight - mesh.m_blendWeights[influenceIndex]));
+                }
+            }
+
+            return error;
+        }
+    } // namespace CompactVertexStreams
+} // namespace AtomSampleViewer
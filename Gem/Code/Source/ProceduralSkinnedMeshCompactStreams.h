@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AtomSampleViewer
+{
+    class ProceduralSkinnedMesh;
+
+    //! Compact layout of the vertex streams of a ProceduralSkinnedMesh, used to measure how much memory and bandwidth smaller
+    //! vertex formats would save, and how much precision they would cost.
+    //! The uv stream is the same in both layouts, so it isn't included.
+    namespace CompactVertexStreams
+    {
+        enum class WeightFormat
+        {
+            Unorm8,
+            Unorm16
+        };
+
+        //! The first sub-mesh of a ProceduralSkinnedMesh in the compact layout
+        struct CompactStreams
+        {
+            uint32_t m_vertexCount = 0;
+            uint32_t m_influencesPerVertex = 0;
+            WeightFormat m_weightFormat = WeightFormat::Unorm16;
+
+            //! The positions are stored relative to their bounding box, as (position - center) / halfExtents in [-1, 1]
+            AZStd::array<float, 3> m_positionCenter = { 0.0f, 0.0f, 0.0f };
+            AZStd::array<float, 3> m_positionHalfExtents = { 1.0f, 1.0f, 1.0f };
+
+            AZStd::vector<uint16_t> m_positions;     //!< R16G16B16A16_FLOAT, since there is no three-component half format
+            AZStd::vector<uint32_t> m_normals;       //!< R16G16_SNORM octahedral encoded normal
+            AZStd::vector<uint32_t> m_tangents;      //!< R16G16_SNORM octahedral encoded tangent. The least significant bit of y is the bitangent sign.
+            AZStd::vector<uint8_t> m_blendIndices;   //!< R8_UINT per influence
+            AZStd::vector<uint8_t> m_blendWeights;   //!< R8_UNORM or R16_UNORM per influence. The weights of each vertex still add up to exactly 1.
+        };
+
+        //! The largest differences between the decoded compact streams and the full precision streams
+        struct EncodingError
+        {
+            float m_maxPositionError = 0.0f;
+            float m_maxNormalErrorDegrees = 0.0f;
+            float m_maxTangentErrorDegrees = 0.0f;
+            float m_maxWeightError = 0.0f;
+            uint32_t m_blendIndexMismatchCount = 0;
+            uint32_t m_bitangentSignMismatchCount = 0;
+        };
+
+        //! Bytes per vertex of the positions, normals, tangents, bitangents, blend indices and blend weights of the full precision layout
+        uint32_t GetFullBytesPerVertex(uint32_t influencesPerVertex);
+        uint32_t GetCompactBytesPerVertex(uint32_t influencesPerVertex, WeightFormat weightFormat);
+
+        //! Encodes the first sub-mesh of the mesh. Bone ids must be less than 256.
+        CompactStreams Encode(const ProceduralSkinnedMesh& mesh, WeightFormat weightFormat);
+
+        //! Decodes the compact streams and compares them to the full precision streams they were encoded from.
+        EncodingError Validate(const ProceduralSkinnedMesh& mesh, const CompactStreams& compactStreams);
+
+        uint16_t FloatToHalf(float value);
+        float HalfToFloat(uint16_t value);
+    } // namespace CompactVertexStreams
+} // namespace AtomSampleViewer
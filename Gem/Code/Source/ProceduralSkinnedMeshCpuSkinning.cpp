@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <ProceduralSkinnedMeshCpuSkinning.h>
+#include <ProceduralSkinnedMesh.h>
+
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AtomSampleViewer
+{
+    namespace CpuSkinning
+    {
+        static constexpr uint32_t FloatsPerVertex = 3;
+        static constexpr uint32_t FloatsPerBoneTransform = ProceduralSkinnedMesh::FloatsPerBoneTransform;
+
+        static void Normalize(float* vector)
+        {
+            const float lengthSq = vector[0] * vector[0] + vector[1] * vector[1] + vector[2] * vector[2];
+            if (lengthSq > 0.0f)
+            {
+                const float inverseLength = 1.0f / sqrtf(lengthSq);
+                vector[0] *= inverseLength;
+                vector[1] *= inverseLength;
+                vector[2] *= inverseLength;
+            }
+        }
+
+        static void ResizeOutput(const ProceduralSkinnedMesh& mesh, SkinnedStreams& output)
+        {
+            output.m_positions.resize(mesh.GetVertexCount() * FloatsPerVertex);
+            output.m_normals.resize(mesh.GetVertexCount() * FloatsPerVertex);
+        }
+
+        void SkinReference(const ProceduralSkinnedMesh& mesh, const float* boneTransforms, SkinnedStreams& output)
+        {
+            ResizeOutput(mesh, output);
+
+            const uint32_t influenceCount = mesh.GetInfluencesPerVertex();
+            for (uint32_t vertexIndex = 0; vertexIndex < mesh.GetVertexCount(); ++vertexIndex)
+            {
+                // Blend the bone transforms by the weights, then transform the vertex by the blended transform
+                float blended[FloatsPerBoneTransform] = {};
+                for (uint32_t i = 0; i < influenceCount; ++i)
+                {
+                    const float weight = mesh.m_blendWeights[vertexIndex * influenceCount + i];
+                    const float* boneTransform = boneTransforms + mesh.GetBlendIndex(vertexIndex, i) * FloatsPerBoneTransform;
+                    for (uint32_t element = 0; element < FloatsPerBoneTransform; ++element)
+                    {
+                        blended[element] += weight * boneTransform[element];
+                    }
+                }
+
+                const float* position = &mesh.m_positions[vertexIndex * FloatsPerVertex];
+                const float* normal = &mesh.m_normals[vertexIndex * FloatsPerVertex];
+                float* skinnedPosition = &output.m_positions[vertexIndex * FloatsPerVertex];
+                float* skinnedNormal = &output.m_normals[vertexIndex * FloatsPerVertex];
+                for (uint32_t row = 0; row < 3; ++row)
+                {
+                    const float* rowElements = blended + row * 4;
+                    skinnedPosition[row] = rowElements[0] * position[0] + rowElements[1] * position[1] + rowElements[2] * position[2] + rowElements[3];
+                    skinnedNormal[row] = rowElements[0] * normal[0] + rowElements[1] * normal[1] + rowElements[2] * normal[2];
+                }
+                Normalize(skinnedNormal);
+            }
+        }
+
+        void SkinSimd(const ProceduralSkinnedMesh& mesh, const float* boneTransforms, SkinnedStreams& output)
+        {
+            using namespace AZ::Simd;
+
+            ResizeOutput(mesh, output);
+
+            // Transpose the bone transforms to columns, so a vertex is transformed by scaling and adding the columns
+            // instead of taking a dot product per row
+            const uint32_t boneCount = mesh.GetBoneCount();
+            AZStd::vector<float> boneColumns(boneCount * 16);
+            for (uint32_t boneIndex = 0; boneIndex < boneCount; ++boneIndex)
+            {
+                const float* boneTransform = boneTransforms + boneIndex * FloatsPerBoneTransform;
+                float* columns = &boneColumns[boneIndex * 16];
+                for (uint32_t column = 0; column < 4; ++column)
+                {
+                    columns[column * 4 + 0] = boneTransform[column];
+                    columns[column * 4 + 1] = boneTransform[4 + column];
+                    columns[column * 4 + 2] = boneTransform[8 + column];
+                    columns[column * 4 + 3] = 0.0f;
+                }
+            }
+
+            const uint32_t influenceCount = mesh.GetInfluencesPerVertex();
+            for (uint32_t vertexIndex = 0; vertexIndex < mesh.GetVertexCount(); ++vertexIndex)
+            {
+                Vec4::FloatType column0 = Vec4::ZeroFloat();
+                Vec4::FloatType column1 = Vec4::ZeroFloat();
+                Vec4::FloatType column2 = Vec4::ZeroFloat();
+                Vec4::FloatType column3 = Vec4::ZeroFloat();
+                for (uint32_t i = 0; i < influenceCount; ++i)
+                {
+                    const Vec4::FloatType weight = Vec4::Splat(mesh.m_blendWeights[vertexIndex * influenceCount + i]);
+                    const float* columns = &boneColumns[mesh.GetBlendIndex(vertexIndex, i) * 16];
+                    column0 = Vec4::Madd(Vec4::LoadUnaligned(columns + 0), weight, column0);
+                    column1 = Vec4::Madd(Vec4::LoadUnaligned(columns + 4), weight, column1);
+                    column2 = Vec4::Madd(Vec4::LoadUnaligned(columns + 8), weight, column2);
+                    column3 = Vec4::Madd(Vec4::LoadUnaligned(columns + 12), weight, column3);
+                }
+
+                const float* position = &mesh.m_positions[vertexIndex * FloatsPerVertex];
+                const float* normal = &mesh.m_normals[vertexIndex * FloatsPerVertex];
+
+                const Vec4::FloatType skinnedPosition = Vec4::Madd(column0, Vec4::Splat(position[0]),
+                    Vec4::Madd(column1, Vec4::Splat(position[1]), Vec4::Madd(column2, Vec4::Splat(position[2]), column3)));
+                const Vec4::FloatType skinnedNormal = Vec4::Madd(column0, Vec4::Splat(normal[0]),
+                    Vec4::Madd(column1, Vec4::Splat(normal[1]), Vec4::Mul(column2, Vec4::Splat(normal[2]))));
+
+                // The output is packed xyz, so store through a temporary instead of writing into the next vertex
+                alignas(16) float result[4];
+                Vec4::StoreAligned(result, skinnedPosition);
+                AZStd::copy(result, result + FloatsPerVertex, &output.m_positions[vertexIndex * FloatsPerVertex]);
+                Vec4::StoreAligned(result, skinnedNormal);
+                Normalize(result);
+                AZStd::copy(result, result + FloatsPerVertex, &output.m_normals[vertexIndex * FloatsPerVertex]);
+            }
+        }
+
+        ComparisonResult Compare(const SkinnedStreams& a, const SkinnedStreams& b)
+        {
+            AZ_Assert(a.m_positions.size() == b.m_positions.size() && a.m_normals.size() == b.m_normals.size(), "Skinned streams must be the same size");
+
+            ComparisonResult result;
+            const size_t vertexCount = a.m_positions.size() / FloatsPerVertex;
+            for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+            {
+                float positionError = 0.0f;
+                float normalError = 0.0f;
+                for (size_t component = 0; component < FloatsPerVertex; ++component)
+                {
+                    const size_t index = vertexIndex * FloatsPerVertex + component;
+                    positionError = AZStd::max(positionError, fabsf(a.m_positions[index] - b.m_positions[index]));
+                    normalError = AZStd::max(normalError, fabsf(a.m_normals[index] - b.m_normals[index]));
+                }
+
+                if (positionError > result.m_maxPositionError)
+                {
+                    result.m_maxPositionError = positionError;
+                    result.m_worstVertex = aznumeric_cast<uint32_t>(vertexIndex);
+                }
+                result.m_maxNormalError = AZStd::max(result.m_maxNormalError, normalError);
+            }
+            return result;
+        }
+
+        bool ReadGpuSkinnedStreams(AZStd::span<const uint8_t> outputBuffer, size_t positionOffsetInBytes, size_t normalOffsetInBytes,
+            uint32_t vertexCount, SkinnedStreams& output)
+        {
+            const size_t streamByteCount = static_cast<size_t>(vertexCount) * FloatsPerVertex * sizeof(float);
+            if (positionOffsetInBytes + streamByteCount > outputBuffer.size() || normalOffsetInBytes + streamByteCount > outputBuffer.size())
+            {
+                return false;
+            }
+
+            output.m_positions.resize(static_cast<size_t>(vertexCount) * FloatsPerVertex);
+            output.m_normals.resize(static_cast<size_t>(vertexCount) * FloatsPerVertex);
+            memcpy(output.m_positions.data(), outputBuffer.data() + positionOffsetInBytes, streamByteCount);
+            memcpy(output.m_normals.data(), outputBuffer.data() + normalOffsetInBytes, streamByteCount);
+
+            // The input normals have the length of the mesh radius, and the reference skinning normalizes its output,
+            // so normalize the GPU normals too and compare only their directions
+            for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+            {
+                Normalize(&output.m_normals[vertexIndex * FloatsPerVertex]);
+            }
+            return true;
+        }
+
+        BenchmarkResult RunBenchmark(const ProceduralSkinnedMesh& mesh, const float* boneTransforms, uint32_t iterationCount)
+        {
+            BenchmarkResult result;
+            result.m_vertexCount = mesh.GetVertexCount();
+            result.m_iterationCount = AZStd::max(1u, iterationCount);
+
+            SkinnedStreams referenceOutput;
+            SkinnedStreams simdOutput;
+            const double totalVertexCount = static_cast<double>(result.m_vertexCount) * result.m_iterationCount;
+
+            // Skin once before timing, so the timed iterations don't include allocating the output
+            SkinReference(mesh, boneTransforms, referenceOutput);
+            SkinSimd(mesh, boneTransforms, simdOutput);
+
+            AZ::Debug::Timer timer;
+            timer.Stamp();
+            for (uint32_t i = 0; i < result.m_iterationCount; ++i)
+            {
+                SkinReference(mesh, boneTransforms, referenceOutput);
+            }
+            result.m_referenceVerticesPerSecond = totalVertexCount / AZStd::max(timer.StampAndGetDeltaTimeInSeconds(), 1e-9f);
+
+            for (uint32_t i = 0; i < result.m_iterationCount; ++i)
+            {
+                SkinSimd(mesh, boneTransforms, simdOutput);
+            }
+            result.m_simdVerticesPerSecond = totalVertexCount / AZStd::max(timer.GetDeltaTimeInSeconds(), 1e-9f);
+
+            result.m_comparison = Compare(referenceOutput, simdOutput);
+            return result;
+        }
+    } // namespace CpuSkinning
+} // namespace AtomSampleViewer
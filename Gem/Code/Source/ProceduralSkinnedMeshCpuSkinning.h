@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AtomSampleViewer
+{
+    class ProceduralSkinnedMesh;
+
+    //! CPU linear blend skinning of the first sub-mesh of a ProceduralSkinnedMesh.
+    //! The scalar version is a reference for validating the other skinning paths, and both versions give a skinning throughput
+    //! baseline that doesn't need a GPU.
+    namespace CpuSkinning
+    {
+        //! Skinned vertex streams, with tightly packed xyz per vertex. The normals are normalized.
+        struct SkinnedStreams
+        {
+            AZStd::vector<float> m_positions;
+            AZStd::vector<float> m_normals;
+        };
+
+        struct ComparisonResult
+        {
+            float m_maxPositionError = 0.0f;
+            float m_maxNormalError = 0.0f;
+            uint32_t m_worstVertex = 0;     //!< The vertex with the largest position error
+        };
+
+        struct BenchmarkResult
+        {
+            uint32_t m_vertexCount = 0;
+            uint32_t m_iterationCount = 0;
+            double m_referenceVerticesPerSecond = 0.0;
+            double m_simdVerticesPerSecond = 0.0;
+            ComparisonResult m_comparison;  //!< The SIMD output compared to the reference output
+        };
+
+        //! @param boneTransforms a row-major float12 per bone, the layout of the bone transform buffer.
+        void SkinReference(const ProceduralSkinnedMesh& mesh, const float* boneTransforms, SkinnedStreams& output);
+
+        //! Same as SkinReference(), with the bone matrices blended in 4-wide SIMD registers.
+        void SkinSimd(const ProceduralSkinnedMesh& mesh, const float* boneTransforms, SkinnedStreams& output);
+
+        //! Compares skinned streams from any two sources, such as the reference and SIMD outputs or a readback of the GPU skinning output.
+        ComparisonResult Compare(const SkinnedStreams& a, const SkinnedStreams& b);
+
+        //! Copies the first vertexCount positions and normals out of a readback of the GPU skinning output buffer.
+        //! The skinning shader writes each stream as tightly packed float3s, starting at the byte offsets of the SkinnedMeshInstance.
+        //! The normals are normalized, like the output of SkinReference.
+        //! @return false if the streams don't fit in the readback data.
+        bool ReadGpuSkinnedStreams(AZStd::span<const uint8_t> outputBuffer, size_t positionOffsetInBytes, size_t normalOffsetInBytes,
+            uint32_t vertexCount, SkinnedStreams& output);
+
+        //! Runs each skinning path iterationCount times and compares their output.
+        BenchmarkResult RunBenchmark(const ProceduralSkinnedMesh& mesh, const float* boneTransforms, uint32_t iterationCount);
+    } // namespace CpuSkinning
+} // namespace AtomSampleViewer
@@ -15,10 +15,15 @@
 #include <Atom/RPI.Reflect/Model/ModelLodAssetCreator.h>
 #include <Atom/RPI.Reflect/Model/SkinJointIdPadding.h>
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshInputBuffers.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 
 namespace
 {
     static const char* const DefaultSkinnedMeshMaterial = "shaders/debugvertexnormals.azmaterial";
+
+    //! Sub-meshes with at least this many elements in a stream are copied in parallel
+    static constexpr uint32_t ElementsPerDuplicateJob = 64 * 1024;
 }
 
 namespace AtomSampleViewer
@@ -75,15 +80,41 @@ namespace AtomSampleViewer
         return viewDescriptor;
     }
 
+    //! Calls copySubMesh(subMeshIndex) for each sub-mesh after the first one. Each call runs in its own job if the sub-meshes are large.
+    template <typename CopyFunctionT>
+    static void ForEachSubMeshCopy(uint32_t elementsPerSubMesh, uint32_t subMeshCount, const CopyFunctionT& copySubMesh)
+    {
+        if (subMeshCount <= 2 || elementsPerSubMesh < ElementsPerDuplicateJob)
+        {
+            for (uint32_t i = 1; i < subMeshCount; ++i)
+            {
+                copySubMesh(i);
+            }
+            return;
+        }
+
+        AZ::JobCompletion completion;
+        for (uint32_t i = 1; i < subMeshCount; ++i)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([&copySubMesh, i]()
+                {
+                    copySubMesh(i);
+                }, true);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+    }
+
     template <typename T>
     static void DuplicateVertices(T& vertices, uint32_t elementsPerSubMesh, uint32_t subMeshCount)
     {
         // Increase the size of the vertex buffer, and then copy the original vertex buffer data into the new elements
         vertices.resize(elementsPerSubMesh * subMeshCount);
-        for (uint32_t i = 1; i < subMeshCount; ++i)
-        {
-            AZStd::copy(vertices.begin(), vertices.begin() + elementsPerSubMesh, vertices.begin() + elementsPerSubMesh * i);
-        }
+        ForEachSubMeshCopy(elementsPerSubMesh, subMeshCount, [&vertices, elementsPerSubMesh](uint32_t i)
+            {
+                AZStd::copy(vertices.begin(), vertices.begin() + elementsPerSubMesh, vertices.begin() + elementsPerSubMesh * i);
+            });
     }
 
     AZ::Data::Instance<AZ::RPI::Model> CreateModelFromProceduralSkinnedMesh(ProceduralSkinnedMesh& proceduralMesh)
@@ -122,15 +153,15 @@ namespace AtomSampleViewer
         DuplicateVertices(proceduralMesh.m_blendIndices, aznumeric_cast<uint32_t>(alignedIndicesVertCount), submeshCount);
 
         // Offset duplicate positions in the +y direction, so each sub-mesh ends up in a unique position
-        for (uint32_t subMeshIndex = 1; subMeshIndex < submeshCount; ++subMeshIndex)
-        {
-            for (uint32_t i = 0; i < proceduralMesh.GetVertexCount(); i ++)
+        ForEachSubMeshCopy(proceduralMesh.GetAlignedVertCountForRGBStream(), submeshCount, [&proceduralMesh](uint32_t subMeshIndex)
             {
-                uint32_t yPosPerSubMesh = (proceduralMesh.GetAlignedVertCountForRGBStream() * subMeshIndex) + (i*3) + 1;
-                proceduralMesh.m_positions[yPosPerSubMesh] +=
-                        aznumeric_cast<float>(subMeshIndex) * proceduralMesh.GetSubMeshYOffset();
-            }
-        }
+                const float yOffset = aznumeric_cast<float>(subMeshIndex) * proceduralMesh.GetSubMeshYOffset();
+                for (uint32_t i = 0; i < proceduralMesh.GetVertexCount(); i ++)
+                {
+                    uint32_t yPosPerSubMesh = (proceduralMesh.GetAlignedVertCountForRGBStream() * subMeshIndex) + (i*3) + 1;
+                    proceduralMesh.m_positions[yPosPerSubMesh] += yOffset;
+                }
+            });
 
         size_t positionStreamSize = proceduralMesh.m_positions.size() / RHI::GetFormatComponentCount(RPI::PositionFormat);
         size_t normalStreamSize = proceduralMesh.m_normals.size() / RHI::GetFormatComponentCount(RPI::NormalFormat);
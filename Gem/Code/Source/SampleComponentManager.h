@@ -129,7 +129,7 @@ namespace AtomSampleViewer
         bool ShowTool(const AZStd::string& toolName, bool enable) override;
         void RequestFrameCapture(const AZStd::string& filePath, bool hideImGui) override;
         bool IsFrameCapturePending() override;
-        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed) override;
+        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, int shardIndex, int shardCount) override;
         void SetNumMSAASamples(int16_t numMsaaSamples) override;
         int16_t GetNumMSAASamples() override;
         void SetDefaultNumMSAASamples(int16_t defaultNumMsaaSamples) override;
@@ -92,7 +92,9 @@ namespace AtomSampleViewer
         //! @param suiteFilePath path to the compiled luac test script
         //! @param exitOnTestEnd if true, exits AtomSampleViewerStandalone when the script finishes, used in jenkins
         //! @param randomSeed the seed for the random generator, frequently used inside lua tests to shuffle the order of the test execution
-        virtual void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed) = 0;
+        //! @param shardIndex the part of the suite to run, from 0 to shardCount - 1. Suites that support sharding only run the tests of their shard.
+        //! @param shardCount the number of parts the suite is split into, so it can be run by several processes at once
+        virtual void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, int shardIndex, int shardCount) = 0;
 
         //! Set the number of MSAA samples
         //! @param numMSAASamples the number of MSAA samples
@@ -90,22 +90,40 @@ namespace AtomSampleViewer
         AZ_Assert(m_modelAssetId.IsValid(), "Failed to get model asset id: %s", modelPath);
     }
 
-    void SceneReloadSoakTestComponent::CreateLatticeInstance(const Transform& transform)
+    void SceneReloadSoakTestComponent::CreateLatticeInstances(AZStd::span<const Transform> transforms)
     {
         Data::Asset<MaterialAsset> materialAsset;
         materialAsset.Create(m_materialAssetId);
 
-        // We have a mixture of both unique and shared instance to give more variety and therefore more opportunity for things to break.
-        bool materialIsUnique = (m_materialIsUnique.size() % 2) == 0;
-        auto materialInstance = materialIsUnique ? Material::Create(materialAsset) : Material::FindOrCreate(materialAsset);
-        m_materialIsUnique.push_back(materialIsUnique);
-
         Data::Asset<ModelAsset> modelAsset;
         modelAsset.Create(m_modelAssetId);
 
-        auto meshHandle = GetMeshFeatureProcessor()->AcquireMesh(Render::MeshHandleDescriptor(modelAsset, materialInstance));
-        GetMeshFeatureProcessor()->SetTransform(meshHandle, transform);
-        m_meshHandles.emplace_back(AZStd::move(meshHandle));
+        // All the shared instances use the same material
+        Data::Instance<Material> sharedMaterialInstance;
+
+        for (const Transform& transform : transforms)
+        {
+            // We have a mixture of both unique and shared instance to give more variety and therefore more opportunity for things to break.
+            bool materialIsUnique = (m_materialIsUnique.size() % 2) == 0;
+            Data::Instance<Material> materialInstance;
+            if (materialIsUnique)
+            {
+                materialInstance = Material::Create(materialAsset);
+            }
+            else
+            {
+                if (!sharedMaterialInstance)
+                {
+                    sharedMaterialInstance = Material::FindOrCreate(materialAsset);
+                }
+                materialInstance = sharedMaterialInstance;
+            }
+            m_materialIsUnique.push_back(materialIsUnique);
+
+            auto meshHandle = GetMeshFeatureProcessor()->AcquireMesh(Render::MeshHandleDescriptor(modelAsset, materialInstance));
+            GetMeshFeatureProcessor()->SetTransform(meshHandle, transform);
+            m_meshHandles.emplace_back(AZStd::move(meshHandle));
+        }
     }
 
     void SceneReloadSoakTestComponent::DestroyLatticeInstances()
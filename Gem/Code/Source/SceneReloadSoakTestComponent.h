@@ -53,7 +53,7 @@ namespace AtomSampleViewer
 
         // EntityLatticeTestComponent overrides...
         void PrepareCreateLatticeInstances(uint32_t instanceCount) override;
-        void CreateLatticeInstance(const AZ::Transform& transform) override;
+        void CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms) override;
         void DestroyLatticeInstances() override;
 
         // AZ::TickBus::Handler overrides...
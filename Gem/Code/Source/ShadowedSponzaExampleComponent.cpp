@@ -83,6 +83,13 @@ namespace AtomSampleViewer
         m_directionalLightFeatureProcessor = m_scene->GetFeatureProcessor<Render::DirectionalLightFeatureProcessorInterface>();
         m_diskLightFeatureProcessor = m_scene->GetFeatureProcessor<Render::DiskLightFeatureProcessorInterface>();
 
+        BenchmarkHarness::Config benchmarkConfig;
+        benchmarkConfig.m_name = "Shadowed Sponza";
+        benchmarkConfig.m_outputName = "shadowedSponza";
+        benchmarkConfig.m_cameraEntityId = GetCameraEntityId();
+        m_benchmarkHarness.ActivateIfRequested(benchmarkConfig);
+        m_benchmarkHarness.BenchmarkLoadStart();
+
         SetupScene();
 
         // enable camera control
@@ -113,6 +120,8 @@ namespace AtomSampleViewer
 
         TickBus::Handler::BusDisconnect();
 
+        m_benchmarkHarness.Deactivate();
+
         m_imguiSidebar.Deactivate();
 
         // disable camera control
@@ -129,11 +138,10 @@ namespace AtomSampleViewer
 
     void ShadowedSponzaExampleComponent::OnTick(float deltaTime, AZ::ScriptTimePoint timePoint)
     {
-        AZ_UNUSED(deltaTime);
-        AZ_UNUSED(timePoint);
-
         using namespace AZ;
 
+        m_benchmarkHarness.Tick(deltaTime, timePoint);
+
         SetInitialCameraTransform();
 
         const auto lightTrans = Transform::CreateRotationZ(m_directionalLightYaw) * Transform::CreateRotationX(m_directionalLightPitch);
@@ -173,6 +181,8 @@ namespace AtomSampleViewer
         m_worldAabb = model->GetModelAsset()->GetAabb();
         UpdateDiskLightCount(DiskLightCountDefault);
 
+        m_benchmarkHarness.BenchmarkLoadEnd();
+
         // Now that the models are initialized, we can allow the script to continue.
         ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ResumeScript);
     }
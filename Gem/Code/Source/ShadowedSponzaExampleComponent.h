@@ -16,6 +16,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Random.h>
+#include <Utils/BenchmarkHarness.h>
 #include <Utils/ImGuiSidebar.h>
 
 namespace AtomSampleViewer
@@ -106,6 +107,8 @@ namespace AtomSampleViewer
         AZ::Render::MeshFeatureProcessorInterface::MeshHandle m_meshHandle;
         bool m_sponzaExteriorAssetLoaded = false;
 
+        BenchmarkHarness m_benchmarkHarness;
+
         // GUI
         ImGuiSidebar m_imguiSidebar;
         float m_directionalLightPitch = -AZ::Constants::QuarterPi;
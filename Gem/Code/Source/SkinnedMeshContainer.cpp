@@ -11,6 +11,9 @@
 #include <ProceduralSkinnedMeshUtils.h>
 #include <SampleComponentConfig.h>
 
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Vector3.h>
 
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
@@ -28,6 +31,16 @@
 namespace
 {
     static const char* const SkinnedMeshMaterial = "materials/defaultpbr.azmaterial";
+
+    //! Instances are laid out in rows along the x-axis, with the sub-meshes of each instance extending along the y-axis
+    static constexpr uint32_t InstancesPerRow = 16;
+    static constexpr float InstanceSpacingX = 2.5f;
+    static constexpr float InstanceRowMargin = 0.5f;
+
+    //! Seconds each instance's animation is ahead of the previous instance, so the instances don't all move in lockstep
+    static constexpr float InstanceAnimationOffset = 0.25f;
+    //! Batches of this many instances are animated in parallel. A multiple of 4, the number of instances animated at once.
+    static constexpr uint32_t InstancesPerAnimationJob = 64;
 }
 
 namespace AtomSampleViewer
@@ -42,9 +55,10 @@ namespace AtomSampleViewer
 
     void SkinnedMeshContainer::SetupSkinnedMeshes()
     {
+        // The skinned meshes are generated when instances are added
         m_skinnedMeshes.clear();
         m_skinnedMeshInstances.clear();
-        SetupNewSkinnedMesh(m_skinnedMeshConfig);
+        m_boneTransformData.clear();
     }
 
     SkinnedMeshContainer::~SkinnedMeshContainer()
@@ -54,7 +68,12 @@ namespace AtomSampleViewer
 
     void SkinnedMeshContainer::SetActiveSkinnedMeshCount(uint32_t activeSkinnedMeshCount)
     {
-        uint32_t skinnedMeshContainerSize = aznumeric_cast<uint32_t>(m_skinnedMeshes.size());
+        while (m_skinnedMeshInstances.size() < activeSkinnedMeshCount)
+        {
+            SetupNewInstance();
+        }
+
+        uint32_t skinnedMeshContainerSize = aznumeric_cast<uint32_t>(m_skinnedMeshInstances.size());
         for (uint32_t i = 0; i < skinnedMeshContainerSize; ++i)
         {
             if (i < activeSkinnedMeshCount)
@@ -66,6 +85,19 @@ namespace AtomSampleViewer
                 ReleaseSkinnedMesh(i);
             }
         }
+
+        // Remove the released instances and the skinned meshes only they used. Creating the input buffers modifies the procedural mesh data,
+        // so it can't be used to create them again.
+        m_skinnedMeshInstances.resize(activeSkinnedMeshCount);
+        if (activeSkinnedMeshCount == 0)
+        {
+            m_skinnedMeshes.clear();
+        }
+        else if (!m_shareInputBuffers)
+        {
+            m_skinnedMeshes.resize(activeSkinnedMeshCount);
+        }
+
         m_activeSkinnedMeshCount = activeSkinnedMeshCount;
     }
 
@@ -79,6 +111,61 @@ namespace AtomSampleViewer
         SetActiveSkinnedMeshCount(skinnedMeshCount);
     }
 
+    void SkinnedMeshContainer::SetShareInputBuffers(bool shareInputBuffers)
+    {
+        if (m_shareInputBuffers == shareInputBuffers)
+        {
+            return;
+        }
+
+        m_shareInputBuffers = shareInputBuffers;
+        const uint32_t skinnedMeshCount = m_activeSkinnedMeshCount;
+        SetActiveSkinnedMeshCount(0);
+        SetupSkinnedMeshes();
+        SetActiveSkinnedMeshCount(skinnedMeshCount);
+    }
+
+    SkinnedMeshContainer::MemoryStats SkinnedMeshContainer::GetMemoryStats() const
+    {
+        MemoryStats stats;
+        stats.m_requestedInstanceCount = m_activeSkinnedMeshCount;
+
+        for (const SkinnedMesh& skinnedMesh : m_skinnedMeshes)
+        {
+            if (!skinnedMesh.m_skinnedMeshInputBuffers)
+            {
+                continue;
+            }
+
+            // The streams hold the data of all of the sub-meshes once the input buffers are created, so their size is used for the buffers
+            const ProceduralSkinnedMesh& mesh = skinnedMesh.m_proceduralSkinnedMesh;
+            const size_t byteCount =
+                mesh.m_indices.size() * sizeof(mesh.m_indices[0]) +
+                mesh.m_positions.size() * sizeof(mesh.m_positions[0]) +
+                mesh.m_normals.size() * sizeof(mesh.m_normals[0]) +
+                mesh.m_tangents.size() * sizeof(mesh.m_tangents[0]) +
+                mesh.m_bitangents.size() * sizeof(mesh.m_bitangents[0]) +
+                mesh.m_uvs.size() * sizeof(mesh.m_uvs[0]) +
+                mesh.m_blendIndices.size() * sizeof(mesh.m_blendIndices[0]) +
+                mesh.m_blendWeights.size() * sizeof(mesh.m_blendWeights[0]);
+
+            stats.m_inputBufferCount++;
+            stats.m_inputBufferByteCount += byteCount;
+            stats.m_savedInputBufferByteCount += byteCount * (skinnedMesh.m_useCount - 1);
+        }
+
+        for (const RenderData& renderData : m_skinnedMeshInstances)
+        {
+            if (renderData.m_skinnedMeshHandle.IsValid())
+            {
+                stats.m_createdInstanceCount++;
+            }
+        }
+        stats.m_outOfMemoryInstanceCount = aznumeric_cast<uint32_t>(m_instancesOutOfMemory.size());
+
+        return stats;
+    }
+
     SkinnedMeshConfig SkinnedMeshContainer::GetSkinnedMeshConfig() const
     {
         return m_skinnedMeshConfig;
@@ -86,21 +173,92 @@ namespace AtomSampleViewer
 
     void SkinnedMeshContainer::UpdateAnimation(float time, bool useOutOfSyncBoneAnimation)
     {
-        uint32_t skinnedMeshContainerSize = aznumeric_cast<uint32_t>(m_skinnedMeshes.size());
-        for (uint32_t i = 0; i < skinnedMeshContainerSize; ++i)
+        if (m_skinnedMeshes.empty())
+        {
+            return;
+        }
+
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+
+        // All of the skinned meshes use the same config, so any of them can animate all of the instances
+        const ProceduralSkinnedMesh& proceduralSkinnedMesh = m_skinnedMeshes.front().m_proceduralSkinnedMesh;
+        const uint32_t instanceCount = aznumeric_cast<uint32_t>(m_skinnedMeshInstances.size());
+        const size_t floatsPerInstance = proceduralSkinnedMesh.GetBoneCount() * ProceduralSkinnedMesh::FloatsPerBoneTransform;
+
+        m_instanceAnimationTimes.resize(instanceCount);
+        m_boneTransformData.resize(instanceCount * floatsPerInstance);
+        for (uint32_t i = 0; i < instanceCount; ++i)
+        {
+            m_instanceAnimationTimes[i] = time + static_cast<float>(i) * InstanceAnimationOffset;
+        }
+
+        auto animateInstances = [this, &proceduralSkinnedMesh, floatsPerInstance, useOutOfSyncBoneAnimation](uint32_t first, uint32_t end)
+        {
+            proceduralSkinnedMesh.CalculateAnimatedBoneTransforms(
+                m_instanceAnimationTimes.data() + first, end - first, useOutOfSyncBoneAnimation, m_boneTransformData.data() + first * floatsPerInstance);
+        };
+
+        if (instanceCount <= InstancesPerAnimationJob)
+        {
+            animateInstances(0, instanceCount);
+        }
+        else
         {
-            if (i < m_activeSkinnedMeshCount)
+            AZ::JobCompletion completion;
+            for (uint32_t first = 0; first < instanceCount; first += InstancesPerAnimationJob)
             {
-                m_skinnedMeshes[i].m_proceduralSkinnedMesh.UpdateAnimation(time, useOutOfSyncBoneAnimation);
+                const uint32_t end = AZStd::min(first + InstancesPerAnimationJob, instanceCount);
+                AZ::Job* job = AZ::CreateJobFunction([&animateInstances, first, end]()
+                    {
+                        animateInstances(first, end);
+                    }, true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
 
-                if (m_skinnedMeshInstances[i].m_boneTransformBuffer)
-                {
-                    m_skinnedMeshInstances[i].m_boneTransformBuffer->UpdateData(
-                        m_skinnedMeshes[i].m_proceduralSkinnedMesh.m_boneMatrices.data(),
-                        m_skinnedMeshes[i].m_proceduralSkinnedMesh.m_boneMatrices.size() * sizeof(AZ::Matrix3x4));
-                }
+        // The bone transforms are already in the layout of the bone transform buffer
+        for (uint32_t i = 0; i < instanceCount; ++i)
+        {
+            RenderData& renderData = m_skinnedMeshInstances[i];
+            if (renderData.m_boneTransformBuffer)
+            {
+                renderData.m_boneTransformBuffer->UpdateData(&m_boneTransformData[i * floatsPerInstance], floatsPerInstance * sizeof(float));
             }
         }
+
+        m_animationTimeInMicroseconds = timer.GetDeltaTimeInSeconds() * 1'000'000;
+    }
+
+    const float* SkinnedMeshContainer::GetAnimatedBoneTransforms(uint32_t i) const
+    {
+        if (i >= m_skinnedMeshInstances.size())
+        {
+            return nullptr;
+        }
+
+        const size_t floatsPerInstance = GetProceduralSkinnedMesh(i).GetBoneCount() * ProceduralSkinnedMesh::FloatsPerBoneTransform;
+        if (m_boneTransformData.size() < (i + 1) * floatsPerInstance)
+        {
+            return nullptr;
+        }
+        return &m_boneTransformData[i * floatsPerInstance];
+    }
+
+    const ProceduralSkinnedMesh& SkinnedMeshContainer::GetProceduralSkinnedMesh(uint32_t i) const
+    {
+        return m_skinnedMeshes[m_skinnedMeshInstances[i].m_skinnedMeshIndex].m_proceduralSkinnedMesh;
+    }
+
+    const AZ::Render::SkinnedMeshInstance* SkinnedMeshContainer::GetSkinnedMeshInstance(uint32_t i) const
+    {
+        if (i >= m_skinnedMeshInstances.size() || !m_skinnedMeshInstances[i].m_skinnedMeshHandle.IsValid())
+        {
+            return nullptr;
+        }
+        return m_skinnedMeshInstances[i].m_skinnedMeshInstance.get();
     }
 
     void SkinnedMeshContainer::DrawBones()
@@ -108,45 +266,65 @@ namespace AtomSampleViewer
         auto rpiScene = AZ::RPI::RPISystemInterface::Get()->GetSceneByName(AZ::Name("RPI"));
         if (auto auxGeom = AZ::RPI::AuxGeomFeatureProcessorInterface::GetDrawQueueForScene(rpiScene))
         {
-            uint32_t skinnedMeshContainerSize = aznumeric_cast<uint32_t>(m_skinnedMeshes.size());
-            for (uint32_t i = 0; i < skinnedMeshContainerSize; ++i)
+            for (uint32_t i = 0; i < m_skinnedMeshInstances.size(); ++i)
             {
-                if (i < m_activeSkinnedMeshCount)
+                const RenderData& renderData = m_skinnedMeshInstances[i];
+                const ProceduralSkinnedMesh& proceduralSkinnedMesh = GetProceduralSkinnedMesh(i);
+                // Draw the rest pose until the instance has been animated
+                const float* animatedBoneTransforms = GetAnimatedBoneTransforms(i);
+
+                for (uint32_t boneIndex = 0; boneIndex < proceduralSkinnedMesh.GetBoneCount(); ++boneIndex)
                 {
-                    for (const AZ::Matrix3x4& boneMatrix : m_skinnedMeshes[i].m_proceduralSkinnedMesh.m_boneMatrices)
-                    {
-                        AZ::Transform boneTransform = AZ::Transform::CreateFromMatrix3x4(boneMatrix);
-                        AZ::Vector3 center = boneTransform.GetTranslation();
-                        AZ::Vector3 direction = boneTransform.GetRotation().TransformVector(AZ::Vector3(0.0f, 0.0f, 1.0f));
-                        float radius = 0.02f;
-                        float height = 0.05f;
-                        auxGeom->DrawCone(center, direction, radius, height, AZ::Color::CreateFromRgba(0, 0, 255, 255), AZ::RPI::AuxGeomDraw::DrawStyle::Line, AZ::RPI::AuxGeomDraw::DepthTest::Off, AZ::RPI::AuxGeomDraw::DepthWrite::Off);
-                    }
+                    const AZ::Matrix3x4 boneMatrix = animatedBoneTransforms
+                        ? AZ::Matrix3x4::CreateFromRowMajorFloat12(animatedBoneTransforms + boneIndex * ProceduralSkinnedMesh::FloatsPerBoneTransform)
+                        : proceduralSkinnedMesh.m_boneMatrices[boneIndex];
+                    AZ::Transform boneTransform = renderData.m_rootTransform * AZ::Transform::CreateFromMatrix3x4(boneMatrix);
+                    AZ::Vector3 center = boneTransform.GetTranslation();
+                    AZ::Vector3 direction = boneTransform.GetRotation().TransformVector(AZ::Vector3(0.0f, 0.0f, 1.0f));
+                    float radius = 0.02f;
+                    float height = 0.05f;
+                    auxGeom->DrawCone(center, direction, radius, height, AZ::Color::CreateFromRgba(0, 0, 255, 255), AZ::RPI::AuxGeomDraw::DrawStyle::Line, AZ::RPI::AuxGeomDraw::DepthTest::Off, AZ::RPI::AuxGeomDraw::DepthWrite::Off);
                 }
             }
         }
     }
 
-    void SkinnedMeshContainer::SetupNewSkinnedMesh(SkinnedMeshConfig& skinnedMeshConfig)
+    void SkinnedMeshContainer::SetupNewInstance()
     {
-        SkinnedMesh newSkinnedMesh;
-        newSkinnedMesh.m_proceduralSkinnedMesh.Resize(skinnedMeshConfig);
-        m_skinnedMeshes.push_back(AZStd::move(newSkinnedMesh));
+        const uint32_t instanceIndex = aznumeric_cast<uint32_t>(m_skinnedMeshInstances.size());
+
+        if (!m_shareInputBuffers || m_skinnedMeshes.empty())
+        {
+            SkinnedMesh newSkinnedMesh;
+            newSkinnedMesh.m_proceduralSkinnedMesh.Resize(m_skinnedMeshConfig);
+            m_skinnedMeshes.push_back(AZStd::move(newSkinnedMesh));
+        }
 
         SkinnedMeshContainer::RenderData newRenderData;
+        newRenderData.m_skinnedMeshIndex = aznumeric_cast<uint32_t>(m_skinnedMeshes.size() - 1);
+        newRenderData.m_rootTransform = GetInstanceTransform(instanceIndex);
         m_skinnedMeshInstances.push_back(AZStd::move(newRenderData));
     }
 
+    AZ::Transform SkinnedMeshContainer::GetInstanceTransform(uint32_t i) const
+    {
+        // The first instance stays at the origin
+        const float rowSpacing = m_skinnedMeshes.front().m_proceduralSkinnedMesh.GetSubMeshYOffset() * m_skinnedMeshConfig.m_subMeshCount + InstanceRowMargin;
+        const float x = static_cast<float>(i % InstancesPerRow) * InstanceSpacingX;
+        const float y = static_cast<float>(i / InstancesPerRow) * rowSpacing;
+        return AZ::Transform::CreateTranslation(AZ::Vector3(x, y, 0.0f));
+    }
+
     void SkinnedMeshContainer::AcquireSkinnedMesh(uint32_t i)
     {
-        // For now, there is a 1-1 match of input meshes to instances
-        SkinnedMesh& skinnedMesh = m_skinnedMeshes[i];
         RenderData& renderData = m_skinnedMeshInstances[i];
-        if (renderData.m_skinnedMeshHandle.IsValid())
+        SkinnedMesh& skinnedMesh = m_skinnedMeshes[renderData.m_skinnedMeshIndex];
+        if (renderData.m_isAcquired)
         {
             return;
         }
 
+        renderData.m_isAcquired = true;
         skinnedMesh.m_useCount++;
         if (!skinnedMesh.m_skinnedMeshInputBuffers)
         {
@@ -158,9 +336,8 @@ namespace AtomSampleViewer
 
     void SkinnedMeshContainer::CreateInstance(uint32_t i)
     {
-        // For now, there is a 1-1 match of input meshes to instances
-        SkinnedMesh& skinnedMesh = m_skinnedMeshes[i];
         RenderData& renderData = m_skinnedMeshInstances[i];
+        SkinnedMesh& skinnedMesh = m_skinnedMeshes[renderData.m_skinnedMeshIndex];
         renderData.m_skinnedMeshInstance = skinnedMesh.m_skinnedMeshInputBuffers->CreateSkinnedMeshInstance();
         if (renderData.m_skinnedMeshInstance)
         {
@@ -204,14 +381,27 @@ namespace AtomSampleViewer
         {
             uint32_t instanceIndex = m_instancesOutOfMemory.front();
             m_instancesOutOfMemory.pop();
-            CreateInstance(instanceIndex);
+
+            // Skip instances that were released while they waited
+            if (instanceIndex < m_skinnedMeshInstances.size() && m_skinnedMeshInstances[instanceIndex].m_isAcquired &&
+                !m_skinnedMeshInstances[instanceIndex].m_skinnedMeshHandle.IsValid())
+            {
+                CreateInstance(instanceIndex);
+            }
         }
     }
 
     void SkinnedMeshContainer::ReleaseSkinnedMesh(uint32_t i)
     {
+        RenderData& renderData = m_skinnedMeshInstances[i];
+        if (!renderData.m_isAcquired)
+        {
+            return;
+        }
+        renderData.m_isAcquired = false;
+
         // Decrement the use count, and release the input buffers if there are no longer any instances using this skinned mesh
-        SkinnedMesh& skinnedMesh = m_skinnedMeshes[i];
+        SkinnedMesh& skinnedMesh = m_skinnedMeshes[renderData.m_skinnedMeshIndex];
         skinnedMesh.m_useCount--;
         if (skinnedMesh.m_useCount == 0)
         {
@@ -219,11 +409,11 @@ namespace AtomSampleViewer
         }
 
         // Release the per-instance data
-        RenderData& renderData = m_skinnedMeshInstances[i];
         m_skinnedMeshFeatureProcessor->ReleaseSkinnedMesh(renderData.m_skinnedMeshHandle);
         if (renderData.m_meshHandle)
         {
             m_meshFeatureProcessor->ReleaseMesh(*renderData.m_meshHandle);
+            renderData.m_meshHandle.reset();
         }
 
         renderData.m_skinnedMeshInstance.reset();
@@ -23,8 +23,9 @@ namespace AtomSampleViewer
     //! Stores a list of skinned meshes and will automatically release them upon destruction of the container.
     //! The skinned mesh input buffers are generated using the ProceduralSkinnedMesh class, so that you can easily create
     //! an arbitrary number of skinned meshes with arbitrary complexity such as vertex count and bone count.
-    //! Currently supports 1 lod per skinned mesh, one sub-mesh per lod, and 1-4 influences per vertex.
-    //! Currently supports a 1-1 mapping of skinned mesh inputs to skinned mesh instances.
+    //! Currently supports 1 lod per skinned mesh, and 1-4 influences per vertex.
+    //! By default each instance has its own skinned mesh inputs. With SetShareInputBuffers(true), all of the instances
+    //! use the input buffers of a single skinned mesh, and only the bone transforms and the skinned output streams are per-instance.
     class SkinnedMeshContainer
         : private AZ::Render::SkinnedMeshOutputStreamNotificationBus::Handler
     {
@@ -43,23 +44,54 @@ namespace AtomSampleViewer
             AZStd::intrusive_ptr<AZ::Render::SkinnedMeshInstance> m_skinnedMeshInstance = nullptr;
             AZ::Data::Instance<AZ::RPI::Buffer> m_boneTransformBuffer = nullptr;
             AZStd::shared_ptr<AZ::Render::MeshFeatureProcessorInterface::MeshHandle> m_meshHandle;
+            uint32_t m_skinnedMeshIndex = 0; //!< Index of the SkinnedMesh in m_skinnedMeshes that the instance is created from
+            bool m_isAcquired = false;
+        };
+
+        struct MemoryStats
+        {
+            uint32_t m_inputBufferCount = 0;        //!< Number of distinct SkinnedMeshInputBuffers in use
+            uint32_t m_requestedInstanceCount = 0;
+            uint32_t m_createdInstanceCount = 0;    //!< Instances that got skinned output streams
+            uint32_t m_outOfMemoryInstanceCount = 0; //!< Instances waiting for memory in the skinned output stream buffer
+            size_t m_inputBufferByteCount = 0;      //!< Size of all of the input buffers, derived from the generated streams. A CPU copy of the same size is kept for each
+            size_t m_savedInputBufferByteCount = 0; //!< Input buffer memory the instances would use without sharing
         };
 
         SkinnedMeshContainer(AZ::Render::SkinnedMeshFeatureProcessorInterface* skinnedMeshFeatureProcessor, AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor, const SkinnedMeshConfig& config);
         AZ_DISABLE_COPY(SkinnedMeshContainer);
         ~SkinnedMeshContainer();
 
+        //! Creates or removes instances so there are activeSkinnedMeshCount of them.
         void SetActiveSkinnedMeshCount(uint32_t activeSkinnedMeshCount);
-        uint32_t GetMaxSkinnedMeshes() const { return aznumeric_cast<uint32_t>(m_skinnedMeshes.size()); }
+        uint32_t GetMaxSkinnedMeshes() const { return aznumeric_cast<uint32_t>(m_skinnedMeshInstances.size()); }
         uint32_t GetActiveSkinnedMeshCount() const { return m_activeSkinnedMeshCount; }
 
         SkinnedMeshConfig GetSkinnedMeshConfig() const;
         void SetSkinnedMeshConfig(const SkinnedMeshConfig& skinnedMeshConfig);
+
+        //! Since all of the instances use the same SkinnedMeshConfig, sharing creates a single set of input buffers for all of them.
+        void SetShareInputBuffers(bool shareInputBuffers);
+        bool GetShareInputBuffers() const { return m_shareInputBuffers; }
+
+        MemoryStats GetMemoryStats() const;
+
+        //! Animates every instance, with each instance a little ahead of the previous one.
+        //! The bones of all of the instances are calculated in one batch on the job system and uploaded straight to the bone transform buffers.
         void UpdateAnimation(float time, bool useOutOfSyncBoneAnimation);
+        //! Returns the bone transforms of an instance from the last UpdateAnimation() call, as row-major float12s, or nullptr if it hasn't been animated.
+        const float* GetAnimatedBoneTransforms(uint32_t i) const;
+        const ProceduralSkinnedMesh& GetProceduralSkinnedMesh(uint32_t i) const;
+        //! Returns the skinned mesh instance that holds the offsets of an instance's skinned output streams,
+        //! or nullptr if the instance hasn't got output streams yet.
+        const AZ::Render::SkinnedMeshInstance* GetSkinnedMeshInstance(uint32_t i) const;
+        //! Returns the CPU time of the last UpdateAnimation() call
+        float GetAnimationTimeInMicroseconds() const { return m_animationTimeInMicroseconds; }
         void DrawBones();
     private:
         void SetupSkinnedMeshes();
-        void SetupNewSkinnedMesh(SkinnedMeshConfig& skinnedMeshConfig);
+        void SetupNewInstance();
+        AZ::Transform GetInstanceTransform(uint32_t i) const;
         void AcquireSkinnedMesh(uint32_t i);
         void CreateInstance(uint32_t i);
         void ReleaseSkinnedMesh(uint32_t i);
@@ -73,6 +105,12 @@ namespace AtomSampleViewer
         AZ::Render::SkinnedMeshFeatureProcessorInterface* m_skinnedMeshFeatureProcessor = nullptr;
         uint32_t m_activeSkinnedMeshCount = 0;
         SkinnedMeshConfig m_skinnedMeshConfig;
+        bool m_shareInputBuffers = false;
+
+        //! Per-instance animation times, and the bone transforms of all instances in the layout of the bone transform buffer
+        AZStd::vector<float> m_instanceAnimationTimes;
+        AZStd::vector<float> m_boneTransformData;
+        float m_animationTimeInMicroseconds = 0.0f;
         AZStd::queue<uint32_t> m_instancesOutOfMemory;
     };
 } // namespace AtomSampleViewer
@@ -12,12 +12,18 @@
 #include <Automation/ScriptableImGui.h>
 
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshInputBuffers.h>
+#include <Atom/Feature/SkinnedMesh/SkinnedMeshInstance.h>
+#include <Atom/Feature/SkinnedMesh/SkinnedMeshVertexStreams.h>
+#include <Atom/Feature/Utils/FrameCaptureBus.h>
 
 #include <Atom/Component/DebugCamera/NoClipControllerComponent.h>
 #include <Atom/Component/DebugCamera/NoClipControllerBus.h>
 
 #include <AzCore/Script/ScriptTimePoint.h>
 
+#include <Atom/RPI.Public/Pass/AttachmentReadback.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/View.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
@@ -27,8 +33,16 @@
 
 #include <RHI/BasicRHIComponent.h>
 
+#include <imgui/imgui.h>
+
 namespace AtomSampleViewer
 {
+    static constexpr uint32_t CpuSkinningBenchmarkIterations = 100;
+    //! The SIMD path blends and transforms in a different order than the reference, so allow for some rounding differences
+    static constexpr float CpuSkinningTolerance = 1e-4f;
+    //! The GPU skinning shader blends and normalizes in a different order than the reference, and doesn't round the same way
+    static constexpr float GpuSkinningTolerance = 1e-3f;
+
     void SkinnedMeshExampleComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -84,7 +98,7 @@ namespace AtomSampleViewer
     {
         m_runTime += deltaTime;
         DrawSidebar();
-        if (!m_useFixedTime)
+        if (!m_useFixedTime && !m_gpuSkinningReadback)
         {
             m_skinnedMeshContainer->UpdateAnimation(m_runTime, m_useOutOfSyncBoneAnimation);
         }
@@ -117,6 +131,22 @@ namespace AtomSampleViewer
             m_skinnedMeshContainer->SetSkinnedMeshConfig(config);
         }
 
+        int instanceCount = static_cast<int>(m_skinnedMeshContainer->GetActiveSkinnedMeshCount());
+        if (ScriptableImGui::SliderInt("Instance Count", &instanceCount, 1, 1024))
+        {
+            m_skinnedMeshContainer->SetActiveSkinnedMeshCount(static_cast<uint32_t>(instanceCount));
+            configWasModified = true;
+        }
+
+        bool shareInputBuffers = m_skinnedMeshContainer->GetShareInputBuffers();
+        if (ScriptableImGui::Checkbox("Share Input Buffers", &shareInputBuffers))
+        {
+            m_skinnedMeshContainer->SetShareInputBuffers(shareInputBuffers);
+            configWasModified = true;
+        }
+
+        DrawMemoryStats();
+
         bool animationWasModified = configWasModified;
         animationWasModified |= ScriptableImGui::Checkbox("Use Fixed Animation Time", &m_useFixedTime);
         animationWasModified |= ScriptableImGui::SliderFloat("Fixed Animation Time", &m_fixedAnimationTime, 0.0f, 20.0f);
@@ -127,8 +157,20 @@ namespace AtomSampleViewer
             m_skinnedMeshContainer->UpdateAnimation(m_fixedAnimationTime, m_useOutOfSyncBoneAnimation);
         }
 
+        // A pending readback was requested for the previous mesh and bones, so it would no longer match the reference.
+        // Dropping the shared state is enough; the callback then only writes into the orphaned copy.
+        if (animationWasModified && m_gpuSkinningReadback)
+        {
+            AZ_Warning("SkinnedMesh", false, "The skinned mesh changed while a GPU skinning readback was pending, so the readback was dropped");
+            m_gpuSkinningReadback.reset();
+        }
+
         ScriptableImGui::Checkbox("Draw bones", &m_drawBones);
 
+        DrawCpuSkinning();
+        DrawGpuSkinningReadback();
+        DrawCompactVertexStreams(configWasModified);
+
         if (ScriptableImGui::Button("Reset Clock"))
         {
             m_runTime = 0;
@@ -137,6 +179,238 @@ namespace AtomSampleViewer
         m_imguiSidebar.End();
     }
 
+    void SkinnedMeshExampleComponent::DrawMemoryStats()
+    {
+        constexpr float BytesPerMegabyte = 1024.0f * 1024.0f;
+        const SkinnedMeshContainer::MemoryStats stats = m_skinnedMeshContainer->GetMemoryStats();
+
+        ImGui::Text("Input buffers: %u (%.2f MB)", stats.m_inputBufferCount, static_cast<float>(stats.m_inputBufferByteCount) / BytesPerMegabyte);
+        ImGui::Text("Saved by sharing: %.2f MB", static_cast<float>(stats.m_savedInputBufferByteCount) / BytesPerMegabyte);
+        ImGui::Text("Instances created: %u / %u", stats.m_createdInstanceCount, stats.m_requestedInstanceCount);
+        ImGui::Text("CPU animation: %.0f us", m_skinnedMeshContainer->GetAnimationTimeInMicroseconds());
+        if (stats.m_outOfMemoryInstanceCount > 0)
+        {
+            // The instances that didn't fit are retried when skinned output stream memory is freed
+            ImGui::Text("Out of output stream memory, max instances: %u", stats.m_createdInstanceCount);
+        }
+    }
+
+    void SkinnedMeshExampleComponent::DrawCpuSkinning()
+    {
+        ImGui::Separator();
+        ImGui::Text("CPU Skinning");
+
+        ScriptableImGui::Checkbox("Validate CPU Skinning", &m_validateCpuSkinning);
+        const bool runBenchmark = ScriptableImGui::Button("Benchmark CPU Skinning");
+
+        // Skin the first instance with the same bone transforms that were uploaded for the GPU skinning
+        const float* boneTransforms = m_skinnedMeshContainer->GetAnimatedBoneTransforms(0);
+        if (!boneTransforms)
+        {
+            ImGui::Text("Waiting for animation");
+            return;
+        }
+        const ProceduralSkinnedMesh& mesh = m_skinnedMeshContainer->GetProceduralSkinnedMesh(0);
+
+        if (m_validateCpuSkinning)
+        {
+            CpuSkinning::SkinReference(mesh, boneTransforms, m_cpuReferenceOutput);
+            CpuSkinning::SkinSimd(mesh, boneTransforms, m_cpuSimdOutput);
+            const CpuSkinning::ComparisonResult comparison = CpuSkinning::Compare(m_cpuReferenceOutput, m_cpuSimdOutput);
+
+            const bool passed = comparison.m_maxPositionError <= CpuSkinningTolerance && comparison.m_maxNormalError <= CpuSkinningTolerance;
+            ImGui::TextColored(passed ? ImVec4(0.0f, 1.0f, 0.0f, 1.0f) : ImVec4(1.0f, 0.0f, 0.0f, 1.0f),
+                "SIMD vs reference: %s", passed ? "match" : "MISMATCH");
+            ImGui::Text("Max position error: %g (vertex %u)", comparison.m_maxPositionError, comparison.m_worstVertex);
+            ImGui::Text("Max normal error: %g", comparison.m_maxNormalError);
+        }
+
+        if (runBenchmark)
+        {
+            m_cpuSkinningBenchmark = CpuSkinning::RunBenchmark(mesh, boneTransforms, CpuSkinningBenchmarkIterations);
+            m_hasCpuSkinningBenchmark = true;
+
+            // Log the results, so they are available from automated runs without a GPU
+            AZ_TracePrintf("SkinnedMesh", "CPU skinning benchmark: %u vertices, %u influences, %u iterations. Reference: %.1f Mverts/s, SIMD: %.1f Mverts/s\n",
+                m_cpuSkinningBenchmark.m_vertexCount, mesh.GetInfluencesPerVertex(), m_cpuSkinningBenchmark.m_iterationCount,
+                m_cpuSkinningBenchmark.m_referenceVerticesPerSecond / 1'000'000.0, m_cpuSkinningBenchmark.m_simdVerticesPerSecond / 1'000'000.0);
+            AZ_Error("SkinnedMesh", m_cpuSkinningBenchmark.m_comparison.m_maxPositionError <= CpuSkinningTolerance && m_cpuSkinningBenchmark.m_comparison.m_maxNormalError <= CpuSkinningTolerance,
+                "CPU skinning SIMD output doesn't match the reference. Max position error %g at vertex %u, max normal error %g",
+                m_cpuSkinningBenchmark.m_comparison.m_maxPositionError, m_cpuSkinningBenchmark.m_comparison.m_worstVertex, m_cpuSkinningBenchmark.m_comparison.m_maxNormalError);
+        }
+
+        if (m_hasCpuSkinningBenchmark)
+        {
+            ImGui::Text("Reference: %.1f Mverts/s", m_cpuSkinningBenchmark.m_referenceVerticesPerSecond / 1'000'000.0);
+            ImGui::Text("SIMD: %.1f Mverts/s", m_cpuSkinningBenchmark.m_simdVerticesPerSecond / 1'000'000.0);
+        }
+    }
+
+    void SkinnedMeshExampleComponent::DrawGpuSkinningReadback()
+    {
+        ImGui::Separator();
+        ImGui::Text("GPU Skinning Readback");
+
+        if (m_gpuSkinningReadback)
+        {
+            AZStd::shared_ptr<AZStd::vector<uint8_t>> outputBuffer;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_gpuSkinningReadback->m_mutex);
+                if (!m_gpuSkinningReadback->m_isFinished)
+                {
+                    ImGui::Text("Waiting for readback");
+                    return;
+                }
+                outputBuffer = m_gpuSkinningReadback->m_outputBuffer;
+            }
+            m_gpuSkinningReadback.reset();
+
+            if (outputBuffer)
+            {
+                CompareGpuSkinningReadback(*outputBuffer);
+            }
+            else
+            {
+                AZ_Error("SkinnedMesh", false, "Failed to read back the skinned mesh output stream buffer");
+            }
+        }
+
+        // The readback copies the whole skinned mesh output buffer, so it only runs on request
+        if (ScriptableImGui::Button("Compare GPU Skinning"))
+        {
+            RequestGpuSkinningReadback();
+        }
+
+        if (m_hasGpuSkinningComparison)
+        {
+            const bool passed = m_gpuSkinningComparison.m_maxPositionError <= GpuSkinningTolerance && m_gpuSkinningComparison.m_maxNormalError <= GpuSkinningTolerance;
+            ImGui::TextColored(passed ? ImVec4(0.0f, 1.0f, 0.0f, 1.0f) : ImVec4(1.0f, 0.0f, 0.0f, 1.0f),
+                "GPU vs reference: %s", passed ? "match" : "MISMATCH");
+            ImGui::Text("Max position error: %g (vertex %u)", m_gpuSkinningComparison.m_maxPositionError, m_gpuSkinningComparison.m_worstVertex);
+            ImGui::Text("Max normal error: %g", m_gpuSkinningComparison.m_maxNormalError);
+        }
+    }
+
+    void SkinnedMeshExampleComponent::RequestGpuSkinningReadback()
+    {
+        const float* boneTransforms = m_skinnedMeshContainer->GetAnimatedBoneTransforms(0);
+        const AZ::Render::SkinnedMeshInstance* skinnedMeshInstance = m_skinnedMeshContainer->GetSkinnedMeshInstance(0);
+        if (!boneTransforms || !skinnedMeshInstance ||
+            skinnedMeshInstance->m_outputStreamOffsetsInBytes.empty() || skinnedMeshInstance->m_outputStreamOffsetsInBytes[0].empty())
+        {
+            AZ_Warning("SkinnedMesh", false, "The first skinned mesh instance isn't animated or doesn't have output streams yet");
+            return;
+        }
+
+        // The offsets of the first sub-mesh of lod 0, which is what the CPU skinning covers
+        const auto& streamOffsets = skinnedMeshInstance->m_outputStreamOffsetsInBytes[0][0];
+        m_gpuSkinningPositionOffset = streamOffsets[static_cast<uint8_t>(AZ::Render::SkinnedMeshOutputVertexStreams::Position)];
+        m_gpuSkinningNormalOffset = streamOffsets[static_cast<uint8_t>(AZ::Render::SkinnedMeshOutputVertexStreams::Normal)];
+
+        const ProceduralSkinnedMesh& mesh = m_skinnedMeshContainer->GetProceduralSkinnedMesh(0);
+        m_gpuSkinningBoneTransforms.assign(boneTransforms, boneTransforms + mesh.GetBoneCount() * ProceduralSkinnedMesh::FloatsPerBoneTransform);
+
+        AZStd::shared_ptr<GpuSkinningReadback> readback = AZStd::make_shared<GpuSkinningReadback>();
+        auto readbackCallback = [readback](const AZ::RPI::AttachmentReadback::ReadbackResult& result)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(readback->m_mutex);
+            readback->m_outputBuffer = result.m_dataBuffer;
+            readback->m_isFinished = true;
+        };
+
+        const AZStd::vector<AZStd::string> passHierarchy = {
+            AZStd::string(m_scene->GetDefaultRenderPipeline()->GetId().GetStringView()), AZStd::string("SkinningPass") };
+
+        AZ::Render::FrameCaptureOutcome captureOutcome;
+        AZ::Render::FrameCaptureRequestBus::BroadcastResult(
+            captureOutcome,
+            &AZ::Render::FrameCaptureRequestBus::Events::CapturePassAttachmentWithCallback,
+            readbackCallback,
+            passHierarchy,
+            AZStd::string("SkinnedMeshOutputStream"),
+            AZ::RPI::PassAttachmentReadbackOption::Output);
+        if (!captureOutcome.IsSuccess())
+        {
+            AZ_Error("SkinnedMesh", false, "%s", captureOutcome.GetError().m_errorMessage.c_str());
+            return;
+        }
+
+        m_gpuSkinningReadback = readback;
+    }
+
+    void SkinnedMeshExampleComponent::CompareGpuSkinningReadback(const AZStd::vector<uint8_t>& outputBuffer)
+    {
+        const ProceduralSkinnedMesh& mesh = m_skinnedMeshContainer->GetProceduralSkinnedMesh(0);
+        if (!CpuSkinning::ReadGpuSkinnedStreams(outputBuffer, m_gpuSkinningPositionOffset, m_gpuSkinningNormalOffset, mesh.GetVertexCount(), m_gpuSkinningOutput))
+        {
+            AZ_Error("SkinnedMesh", false, "The skinned output streams of the first instance are outside of the %zu bytes that were read back", outputBuffer.size());
+            return;
+        }
+
+        CpuSkinning::SkinReference(mesh, m_gpuSkinningBoneTransforms.data(), m_gpuSkinningReferenceOutput);
+        m_gpuSkinningComparison = CpuSkinning::Compare(m_gpuSkinningReferenceOutput, m_gpuSkinningOutput);
+        m_hasGpuSkinningComparison = true;
+
+        // Log the result, so automated runs can check it
+        AZ_Error("SkinnedMesh", m_gpuSkinningComparison.m_maxPositionError <= GpuSkinningTolerance && m_gpuSkinningComparison.m_maxNormalError <= GpuSkinningTolerance,
+            "GPU skinning output doesn't match the CPU reference. Max position error %g at vertex %u, max normal error %g",
+            m_gpuSkinningComparison.m_maxPositionError, m_gpuSkinningComparison.m_worstVertex, m_gpuSkinningComparison.m_maxNormalError);
+    }
+
+    void SkinnedMeshExampleComponent::DrawCompactVertexStreams(bool configWasModified)
+    {
+        ImGui::Separator();
+        ImGui::Text("Compact Vertex Streams");
+
+        m_compactVertexStreamsNeedUpdate |= configWasModified;
+        m_compactVertexStreamsNeedUpdate |= ScriptableImGui::Checkbox("Show Compact Vertex Streams", &m_showCompactVertexStreams);
+        m_compactVertexStreamsNeedUpdate |= ScriptableImGui::Checkbox("8-bit Weights", &m_useUnorm8Weights);
+
+        if (!m_showCompactVertexStreams || m_skinnedMeshContainer->GetMaxSkinnedMeshes() == 0)
+        {
+            return;
+        }
+
+        const ProceduralSkinnedMesh& mesh = m_skinnedMeshContainer->GetProceduralSkinnedMesh(0);
+        const CompactVertexStreams::WeightFormat weightFormat =
+            m_useUnorm8Weights ? CompactVertexStreams::WeightFormat::Unorm8 : CompactVertexStreams::WeightFormat::Unorm16;
+
+        // Encoding is only redone when something changes, since it's as slow as generating the mesh
+        if (m_compactVertexStreamsNeedUpdate)
+        {
+            const CompactVertexStreams::CompactStreams compactStreams = CompactVertexStreams::Encode(mesh, weightFormat);
+            m_compactVertexStreamError = CompactVertexStreams::Validate(mesh, compactStreams);
+            m_compactVertexStreamsNeedUpdate = false;
+        }
+
+        constexpr double BytesPerMegabyte = 1024.0 * 1024.0;
+        const SkinnedMeshContainer::MemoryStats stats = m_skinnedMeshContainer->GetMemoryStats();
+        const uint32_t fullBytesPerVertex = CompactVertexStreams::GetFullBytesPerVertex(mesh.GetInfluencesPerVertex());
+        const uint32_t compactBytesPerVertex = CompactVertexStreams::GetCompactBytesPerVertex(mesh.GetInfluencesPerVertex(), weightFormat);
+        const double verticesPerMesh = static_cast<double>(mesh.GetVertexCount()) * mesh.GetSubMeshCount();
+
+        // The compact streams aren't uploaded, so their memory is derived from the size of the generated streams behind the input buffers
+        // in use, not read from the GPU buffers, minus what the compact layout would save. Each input buffer is stored once, but the
+        // skinning pass reads the input streams of every instance every frame.
+        const double savedBytesPerBuffer = static_cast<double>(fullBytesPerVertex - compactBytesPerVertex) * verticesPerMesh;
+        const double fullMemory = stats.m_inputBufferByteCount / BytesPerMegabyte;
+        const double compactMemory = (stats.m_inputBufferByteCount - savedBytesPerBuffer * stats.m_inputBufferCount) / BytesPerMegabyte;
+        const double fullBandwidth = fullBytesPerVertex * verticesPerMesh * stats.m_createdInstanceCount / BytesPerMegabyte;
+        const double compactBandwidth = compactBytesPerVertex * verticesPerMesh * stats.m_createdInstanceCount / BytesPerMegabyte;
+
+        ImGui::Text("Bytes per vertex: %u -> %u (excluding uvs)", fullBytesPerVertex, compactBytesPerVertex);
+        ImGui::Text("Input memory (from generated streams): %.2f MB -> %.2f MB", fullMemory, compactMemory);
+        ImGui::Text("Skinning reads per frame (estimate): %.2f MB -> %.2f MB", fullBandwidth, compactBandwidth);
+        ImGui::Text("Max position error: %g", m_compactVertexStreamError.m_maxPositionError);
+        ImGui::Text("Max normal / tangent error: %.3f / %.3f deg", m_compactVertexStreamError.m_maxNormalErrorDegrees, m_compactVertexStreamError.m_maxTangentErrorDegrees);
+        ImGui::Text("Max weight error: %g", m_compactVertexStreamError.m_maxWeightError);
+        if (m_compactVertexStreamError.m_blendIndexMismatchCount > 0 || m_compactVertexStreamError.m_bitangentSignMismatchCount > 0)
+        {
+            ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "Mismatched bone ids: %u, bitangent signs: %u",
+                m_compactVertexStreamError.m_blendIndexMismatchCount, m_compactVertexStreamError.m_bitangentSignMismatchCount);
+        }
+    }
+
     void SkinnedMeshExampleComponent::CreateSkinnedMeshContainer()
     {
         const auto skinnedMeshFeatureProcessor = m_scene->GetFeatureProcessor<AZ::Render::SkinnedMeshFeatureProcessorInterface>();
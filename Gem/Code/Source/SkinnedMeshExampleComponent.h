@@ -10,10 +10,15 @@
 
 #include <CommonSampleComponentBase.h>
 #include <SkinnedMeshContainer.h>
+#include <ProceduralSkinnedMeshCompactStreams.h>
+#include <ProceduralSkinnedMeshCpuSkinning.h>
 
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
 #include <AzFramework/Input/Events/InputChannelEventListener.h>
 #include <AtomCore/Instance/Instance.h>
 
@@ -58,6 +63,12 @@ namespace AtomSampleViewer
         void ConfigureCamera();
         void AddImageBasedLight();
         void DrawSidebar();
+        void DrawMemoryStats();
+        void DrawCpuSkinning();
+        void DrawGpuSkinningReadback();
+        void RequestGpuSkinningReadback();
+        void CompareGpuSkinningReadback(const AZStd::vector<uint8_t>& outputBuffer);
+        void DrawCompactVertexStreams(bool configWasModified);
 
         Utils::DefaultIBL m_defaultIbl;
         AZ::Render::MeshFeatureProcessorInterface::MeshHandle m_planeMeshHandle;
@@ -68,6 +79,39 @@ namespace AtomSampleViewer
         bool m_useOutOfSyncBoneAnimation = false;
         bool m_drawBones = true;
 
+        //! CPU skinning of the first instance, to validate the SIMD path against the reference and to benchmark them
+        bool m_validateCpuSkinning = false;
+        CpuSkinning::SkinnedStreams m_cpuReferenceOutput;
+        CpuSkinning::SkinnedStreams m_cpuSimdOutput;
+        CpuSkinning::BenchmarkResult m_cpuSkinningBenchmark;
+        bool m_hasCpuSkinningBenchmark = false;
+
+        //! Filled by the readback callback, which can run on another thread
+        struct GpuSkinningReadback
+        {
+            AZStd::mutex m_mutex;
+            AZStd::shared_ptr<AZStd::vector<uint8_t>> m_outputBuffer;
+            bool m_isFinished = false;
+        };
+
+        //! Readback of the GPU skinning output of the first instance, compared to the CPU reference skinned with the same bones.
+        //! The animation is held while a readback is pending, so the frame that is read back uses the bones that were saved.
+        //! Changing the mesh or the animation drops a pending readback.
+        AZStd::shared_ptr<GpuSkinningReadback> m_gpuSkinningReadback;
+        AZStd::vector<float> m_gpuSkinningBoneTransforms;
+        size_t m_gpuSkinningPositionOffset = 0;
+        size_t m_gpuSkinningNormalOffset = 0;
+        CpuSkinning::SkinnedStreams m_gpuSkinningOutput;
+        CpuSkinning::SkinnedStreams m_gpuSkinningReferenceOutput;
+        CpuSkinning::ComparisonResult m_gpuSkinningComparison;
+        bool m_hasGpuSkinningComparison = false;
+
+        //! Sizes and precision of the compact vertex stream layout, for comparison with the full precision streams the sample renders with
+        bool m_showCompactVertexStreams = false;
+        bool m_useUnorm8Weights = false;
+        bool m_compactVertexStreamsNeedUpdate = true;
+        CompactVertexStreams::EncodingError m_compactVertexStreamError;
+
         AZStd::unique_ptr<SkinnedMeshContainer> m_skinnedMeshContainer;
     };
 } // namespace AtomSampleViewer
@@ -0,0 +1,665 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/BenchmarkHarness.h>
+#include <Utils/Utils.h>
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/time.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/Windowing/WindowBus.h>
+
+#include <imgui/imgui.h>
+
+#include <ctime>
+
+namespace AtomSampleViewer
+{
+    namespace
+    {
+        const char* BenchmarkFlagName = "benchmark";
+        const char* BenchmarkWarmupFlagName = "benchmarkWarmup";
+        const char* BenchmarkCameraPathFlagName = "benchmarkCameraPath";
+
+        const AzFramework::CommandLine* GetCommandLine()
+        {
+            const AzFramework::CommandLine* commandLine = nullptr;
+            AzFramework::ApplicationRequests::Bus::BroadcastResult(commandLine, &AzFramework::ApplicationRequests::GetCommandLine);
+            return commandLine;
+        }
+
+        //! Reads a frame count from the first value of a command line switch. Returns false if there's no valid value.
+        bool GetFrameCountSwitchValue(const AzFramework::CommandLine* commandLine, const char* switchName, AZ::u64& frameCount)
+        {
+            if (!commandLine || commandLine->GetNumSwitchValues(switchName) == 0)
+            {
+                return false;
+            }
+
+            int value = 0;
+            const AZStd::string valueStr = commandLine->GetSwitchValue(switchName, 0);
+            if (!AZ::StringFunc::LooksLikeInt(valueStr.c_str(), &value) || value < 0)
+            {
+                AZ_Warning("BenchmarkHarness", false, "Ignoring invalid frame count '%s' for -%s.", valueStr.c_str(), switchName);
+                return false;
+            }
+
+            frameCount = static_cast<AZ::u64>(value);
+            return true;
+        }
+
+        AzFramework::WindowSize GetRenderResolution()
+        {
+            AzFramework::NativeWindowHandle windowHandle = nullptr;
+            AzFramework::WindowSystemRequestBus::BroadcastResult(
+                windowHandle,
+                &AzFramework::WindowSystemRequestBus::Events::GetDefaultWindowHandle);
+
+            AzFramework::WindowSize windowSize;
+            AzFramework::WindowRequestBus::EventResult(
+                windowSize,
+                windowHandle,
+                &AzFramework::WindowRequestBus::Events::GetRenderResolution);
+            return windowSize;
+        }
+    }
+
+    void BenchmarkHarness::Reflect(AZ::ReflectContext* context)
+    {
+        LoadBenchmarkData::Reflect(context);
+        LoadBenchmarkData::FileLoadedData::Reflect(context);
+        SegmentBenchmarkData::Reflect(context);
+        RunBenchmarkData::Reflect(context);
+    }
+
+    void BenchmarkHarness::LoadBenchmarkData::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<BenchmarkHarness::LoadBenchmarkData>()
+                ->Version(0)
+                ->Field("Name", &BenchmarkHarness::LoadBenchmarkData::m_name)
+                ->Field("TimeInSeconds", &BenchmarkHarness::LoadBenchmarkData::m_timeInSeconds)
+                ->Field("TotalMBLoaded", &BenchmarkHarness::LoadBenchmarkData::m_totalMBLoaded)
+                ->Field("MB/s", &BenchmarkHarness::LoadBenchmarkData::m_mbPerSec)
+                ->Field("# of Files Loaded", &BenchmarkHarness::LoadBenchmarkData::m_numFilesLoaded)
+                ->Field("FilesLoaded", &BenchmarkHarness::LoadBenchmarkData::m_filesLoaded)
+                ;
+        }
+    }
+
+    void BenchmarkHarness::LoadBenchmarkData::FileLoadedData::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<BenchmarkHarness::LoadBenchmarkData::FileLoadedData>()
+                ->Version(0)
+                ->Field("RelativePath", &BenchmarkHarness::LoadBenchmarkData::FileLoadedData::m_relativePath)
+                ->Field("BytesLoaded", &BenchmarkHarness::LoadBenchmarkData::FileLoadedData::m_bytesLoaded)
+                ;
+        }
+    }
+
+    void BenchmarkHarness::SegmentBenchmarkData::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<BenchmarkHarness::SegmentBenchmarkData>()
+                ->Version(0)
+                ->Field("Name", &BenchmarkHarness::SegmentBenchmarkData::m_name)
+                ->Field("FrameCount", &BenchmarkHarness::SegmentBenchmarkData::m_frameCount)
+                ->Field("AverageFrameTime", &BenchmarkHarness::SegmentBenchmarkData::m_averageFrameTime)
+                ->Field("FrameTimeStdDev", &BenchmarkHarness::SegmentBenchmarkData::m_frameTimeStdDev)
+                ->Field("50% of FrameTimes Under", &BenchmarkHarness::SegmentBenchmarkData::m_50pFramesUnder)
+                ->Field("90% of FrameTimes Under", &BenchmarkHarness::SegmentBenchmarkData::m_90pFramesUnder)
+                ->Field("99% of FrameTimes Under", &BenchmarkHarness::SegmentBenchmarkData::m_99pFramesUnder)
+                ->Field("MaxFrameTime", &BenchmarkHarness::SegmentBenchmarkData::m_maxFrameTime)
+                ->Field("HitchCount", &BenchmarkHarness::SegmentBenchmarkData::m_hitchCount)
+                ;
+        }
+    }
+
+    void BenchmarkHarness::RunBenchmarkData::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<BenchmarkHarness::RunBenchmarkData>()
+                ->Version(3)
+                ->Field("Name", &BenchmarkHarness::RunBenchmarkData::m_name)
+                ->Field("WarmupFrameCount", &BenchmarkHarness::RunBenchmarkData::m_warmupFrameCount)
+                ->Field("FrameCount", &BenchmarkHarness::RunBenchmarkData::m_frameCount)
+                ->Field("TimeToFirstFrame", &BenchmarkHarness::RunBenchmarkData::m_timeToFirstFrame)
+                ->Field("TimeInSeconds", &BenchmarkHarness::RunBenchmarkData::m_timeInSeconds)
+                ->Field("AverageFrameTime", &BenchmarkHarness::RunBenchmarkData::m_averageFrameTime)
+                ->Field("50% of FrameTimes Under", &BenchmarkHarness::RunBenchmarkData::m_50pFramesUnder)
+                ->Field("90% of FrameTimes Under", &BenchmarkHarness::RunBenchmarkData::m_90pFramesUnder)
+                ->Field("95% of FrameTimes Under", &BenchmarkHarness::RunBenchmarkData::m_95pFramesUnder)
+                ->Field("99% of FrameTimes Under", &BenchmarkHarness::RunBenchmarkData::m_99pFramesUnder)
+                ->Field("99.9% of FrameTimes Under", &BenchmarkHarness::RunBenchmarkData::m_999pFramesUnder)
+                ->Field("FrameTimeStdDev", &BenchmarkHarness::RunBenchmarkData::m_frameTimeStdDev)
+                ->Field("MinFrameTime", &BenchmarkHarness::RunBenchmarkData::m_minFrameTime)
+                ->Field("MaxFrameTime", &BenchmarkHarness::RunBenchmarkData::m_maxFrameTime)
+                ->Field("AverageFrameRate", &BenchmarkHarness::RunBenchmarkData::m_averageFrameRate)
+                ->Field("MinFrameRate", &BenchmarkHarness::RunBenchmarkData::m_minFrameRate)
+                ->Field("MaxFrameRate", &BenchmarkHarness::RunBenchmarkData::m_maxFrameRate)
+                ->Field("HitchThreshold", &BenchmarkHarness::RunBenchmarkData::m_hitchThresholdMs)
+                ->Field("HitchCount", &BenchmarkHarness::RunBenchmarkData::m_hitchCount)
+                ->Field("Segments", &BenchmarkHarness::RunBenchmarkData::m_segments)
+                ;
+        }
+    }
+
+    bool BenchmarkHarness::IsBenchmarkRequested()
+    {
+        const AzFramework::CommandLine* commandLine = GetCommandLine();
+        return commandLine && commandLine->HasSwitch(BenchmarkFlagName);
+    }
+
+    BenchmarkHarness::~BenchmarkHarness()
+    {
+        Deactivate();
+    }
+
+    void BenchmarkHarness::Activate(const Config& config)
+    {
+        m_config = config;
+
+        const AzFramework::CommandLine* commandLine = GetCommandLine();
+        GetFrameCountSwitchValue(commandLine, BenchmarkFlagName, m_config.m_runFrames);
+        GetFrameCountSwitchValue(commandLine, BenchmarkWarmupFlagName, m_config.m_warmupFrames);
+        if (commandLine && commandLine->GetNumSwitchValues(BenchmarkCameraPathFlagName) > 0)
+        {
+            m_config.m_cameraPathAsset = commandLine->GetSwitchValue(BenchmarkCameraPathFlagName, 0);
+        }
+
+        m_cameraPath = CameraPath();
+        if (!m_config.m_cameraPathAsset.empty())
+        {
+            auto loadOutcome = CameraPath::LoadFromAsset(m_config.m_cameraPathAsset);
+            if (loadOutcome.IsSuccess())
+            {
+                m_cameraPath = loadOutcome.TakeValue();
+            }
+            else
+            {
+                AZ_Error("BenchmarkHarness", false, "%s", loadOutcome.GetError().c_str());
+            }
+        }
+
+        if (m_config.m_runFrames == 0)
+        {
+            m_config.m_runFrames = m_cameraPath.m_keys.empty() ? DefaultRunFrames : m_cameraPath.GetFrameCount();
+        }
+
+        m_phase = Phase::Idle;
+        m_firstResultsDisplay = true;
+    }
+
+    void BenchmarkHarness::ActivateIfRequested(const Config& config)
+    {
+        if (IsBenchmarkRequested())
+        {
+            Activate(config);
+        }
+    }
+
+    void BenchmarkHarness::Deactivate()
+    {
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect();
+
+        // Don't leave a capture running if the sample is closed before the benchmark finished
+        if (m_phase == Phase::Loading || m_phase == Phase::Recording)
+        {
+            Utils::ToggleRadTMCapture();
+        }
+
+        m_assetsToWaitFor.clear();
+        m_phase = Phase::Inactive;
+    }
+
+    void BenchmarkHarness::BenchmarkLoadStart(const AZStd::vector<AZ::Data::AssetId>& assetsToWaitFor)
+    {
+        if (m_phase != Phase::Idle)
+        {
+            return;
+        }
+
+        m_assetsToWaitFor = assetsToWaitFor;
+
+        AZStd::vector<AZ::Data::AssetId> unloadedAssetsInCatalog = assetsToWaitFor;
+
+        // Get a vector of all assets that haven't been loaded
+        auto startCB = []() {};
+        auto enumerateCB = [&unloadedAssetsInCatalog](const AZ::Data::AssetId id, [[maybe_unused]] const AZ::Data::AssetInfo& assetInfo)
+        {
+            // Don't "get" the asset and load it, we just want to query its status
+            AZ::Data::Asset<AZ::Data::AssetData> asset = AZ::Data::AssetManager::Instance().FindAsset(id, AZ::Data::AssetLoadBehavior::PreLoad);
+
+            if (asset.GetData() == nullptr || asset.GetStatus() == AZ::Data::AssetData::AssetStatus::NotLoaded)
+            {
+                unloadedAssetsInCatalog.push_back(id);
+            }
+        };
+        auto endCB = []() {};
+
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::EnumerateAssets, startCB, enumerateCB, endCB);
+
+        m_currentLoadBenchmarkData = LoadBenchmarkData();
+        m_currentLoadBenchmarkData.m_name = m_config.m_name + " Load";
+
+        Utils::ToggleRadTMCapture();
+        m_loadStartTime = static_cast<double>(AZStd::GetTimeUTCMilliSecond());
+        m_phase = Phase::Loading;
+
+        // Connect specifically to all assets in the catalog that haven't been loaded yet
+        // Otherwise if we just connect to *every* asset the ones that have already been loaded
+        // will still trigger OnAssetReady events
+        for (const AZ::Data::AssetId& id : unloadedAssetsInCatalog)
+        {
+            // OnAssetReady will keep track of number and size of all the files that are loaded during this benchmark
+            AZ::Data::AssetBus::MultiHandler::BusConnect(id);
+        }
+    }
+
+    void BenchmarkHarness::BenchmarkLoadEnd()
+    {
+        if (m_phase != Phase::Loading)
+        {
+            return;
+        }
+
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect();
+
+        Utils::ToggleRadTMCapture();
+
+        FinalizeLoadBenchmarkData();
+
+        const AZStd::string filePathBase = GetResultFilePathBase("Load");
+
+        const AZStd::string xmlFilePath = filePathBase + ".xml";
+        if (!AZ::Utils::SaveObjectToFile(xmlFilePath, AZ::DataStream::ST_XML, &m_currentLoadBenchmarkData))
+        {
+            AZ_Error("BenchmarkHarness", false, "Failed to save benchmark load data to file %s", xmlFilePath.c_str());
+        }
+
+        const AZStd::string jsonFilePath = filePathBase + ".json";
+        if (!AZ::JsonSerializationUtils::SaveObjectToFile(&m_currentLoadBenchmarkData, jsonFilePath).IsSuccess())
+        {
+            AZ_Error("BenchmarkHarness", false, "Failed to save benchmark load data to file %s", jsonFilePath.c_str());
+        }
+
+        m_loadEndTime = static_cast<double>(AZStd::GetTimeUTCMilliSecond());
+        m_warmupFramesRemaining = m_config.m_warmupFrames;
+        m_phase = Phase::WarmUp;
+    }
+
+    void BenchmarkHarness::OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        // Benchmark the count and total size of files loaded
+        static double invBytesToMB = 1 / (1024.0 * 1024.0);
+
+        AZ::Data::AssetInfo info;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(info, &AZ::Data::AssetCatalogRequests::GetAssetInfoById, asset.GetId());
+
+        LoadBenchmarkData::FileLoadedData fileLoadedData;
+        fileLoadedData.m_relativePath = info.m_relativePath;
+        fileLoadedData.m_bytesLoaded = info.m_sizeBytes;
+
+        m_currentLoadBenchmarkData.m_totalMBLoaded += static_cast<double>(info.m_sizeBytes) * invBytesToMB;
+        m_currentLoadBenchmarkData.m_filesLoaded.emplace_back(AZStd::move(fileLoadedData));
+
+        AZ_PROFILE_DATAPOINT(AzRender, m_currentLoadBenchmarkData.m_totalMBLoaded, L"MB Loaded Off Disk");
+
+        auto waitIter = AZStd::find(m_assetsToWaitFor.begin(), m_assetsToWaitFor.end(), asset.GetId());
+        if (waitIter != m_assetsToWaitFor.end())
+        {
+            m_assetsToWaitFor.erase(waitIter);
+            if (m_assetsToWaitFor.empty())
+            {
+                BenchmarkLoadEnd();
+            }
+        }
+    }
+
+    void BenchmarkHarness::FinalizeLoadBenchmarkData()
+    {
+        m_currentLoadBenchmarkData.m_timeInSeconds = (static_cast<double>(AZStd::GetTimeUTCMilliSecond()) - m_loadStartTime) / 1000.0;
+        m_currentLoadBenchmarkData.m_mbPerSec = m_currentLoadBenchmarkData.m_totalMBLoaded / m_currentLoadBenchmarkData.m_timeInSeconds;
+        m_currentLoadBenchmarkData.m_numFilesLoaded = m_currentLoadBenchmarkData.m_filesLoaded.size();
+    }
+
+    void BenchmarkHarness::Tick(float deltaTime, AZ::ScriptTimePoint timePoint)
+    {
+        switch (m_phase)
+        {
+        case Phase::WarmUp:
+            if (m_warmupFramesRemaining > 0)
+            {
+                --m_warmupFramesRemaining;
+                UpdateCameraPath();
+                break;
+            }
+
+            BenchmarkRunStart(timePoint);
+            [[fallthrough]];
+
+        case Phase::Recording:
+            CollectRunBenchmarkData(deltaTime, timePoint);
+            UpdateCameraPath();
+
+            if (++m_runFrameIndex >= m_config.m_runFrames)
+            {
+                BenchmarkRunEnd();
+            }
+            break;
+
+        case Phase::Finished:
+            DisplayResults(deltaTime);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    void BenchmarkHarness::BenchmarkRunStart(AZ::ScriptTimePoint timePoint)
+    {
+        m_currentRunBenchmarkData = RunBenchmarkData();
+        m_currentRunBenchmarkData.m_name = m_config.m_name + " Run";
+        m_currentRunBenchmarkData.m_warmupFrameCount = m_config.m_warmupFrames;
+        m_currentRunBenchmarkData.m_timeToFirstFrame = (static_cast<double>(AZStd::GetTimeUTCMilliSecond()) - m_loadEndTime) / 1000.0;
+        m_runFrameTimes.Reset();
+        m_segmentFrameTimes.clear();
+        m_segmentFrameTimes.resize(m_cameraPath.m_segments.size());
+        m_runFrameIndex = 0;
+
+        Utils::ToggleRadTMCapture();
+        m_runStartTimePoint = timePoint.GetSeconds();
+        m_phase = Phase::Recording;
+    }
+
+    void BenchmarkHarness::CollectRunBenchmarkData(float deltaTime, AZ::ScriptTimePoint timePoint)
+    {
+        const float dtInMS = deltaTime * 1000.0f;
+
+        m_runFrameTimes.PushValue(dtInMS);
+        m_frameTimeHistory.PushValue(dtInMS);
+
+        if (!m_segmentFrameTimes.empty())
+        {
+            // The frame that just ended was rendered from the camera placed by the previous Tick()
+            const AZ::u64 renderedFrameIndex = m_runFrameIndex > 0 ? m_runFrameIndex - 1 : 0;
+            const int segmentIndex = m_cameraPath.GetSegmentIndex(m_cameraPath.GetTimeAtFrame(renderedFrameIndex));
+            if (segmentIndex >= 0)
+            {
+                m_segmentFrameTimes[segmentIndex].PushValue(dtInMS);
+            }
+        }
+        m_currentRunBenchmarkData.m_frameCount++;
+        m_currentRunBenchmarkData.m_timeInSeconds = timePoint.GetSeconds() - m_runStartTimePoint;
+    }
+
+    void BenchmarkHarness::FinalizeRunBenchmarkData()
+    {
+        RunBenchmarkData& data = m_currentRunBenchmarkData;
+
+        data.m_averageFrameTime = (data.m_timeInSeconds / data.m_frameCount) * 1000.0f;
+        data.m_frameTimeStdDev = m_runFrameTimes.GetStandardDeviation();
+
+        data.m_50pFramesUnder = static_cast<float>(m_runFrameTimes.GetQuantile(0.5));
+        data.m_90pFramesUnder = static_cast<float>(m_runFrameTimes.GetQuantile(0.9));
+        data.m_95pFramesUnder = static_cast<float>(m_runFrameTimes.GetQuantile(0.95));
+        data.m_99pFramesUnder = static_cast<float>(m_runFrameTimes.GetQuantile(0.99));
+        data.m_999pFramesUnder = static_cast<float>(m_runFrameTimes.GetQuantile(0.999));
+
+        data.m_minFrameTime = static_cast<float>(m_runFrameTimes.GetMin());
+        data.m_maxFrameTime = static_cast<float>(m_runFrameTimes.GetMax());
+
+        // The slowest frame has the lowest frame rate and vice versa
+        data.m_minFrameRate = data.m_maxFrameTime > 0.0f ? 1000.0f / data.m_maxFrameTime : 0.0f;
+        data.m_maxFrameRate = data.m_minFrameTime > 0.0f ? 1000.0f / data.m_minFrameTime : 0.0f;
+        data.m_averageFrameRate = static_cast<float>(m_runFrameTimes.GetMeanFrameRate());
+
+        data.m_hitchThresholdMs = data.m_50pFramesUnder * HitchMedianMultiplier;
+        data.m_hitchCount = m_runFrameTimes.GetCountAbove(data.m_hitchThresholdMs);
+
+        data.m_segments.clear();
+        for (size_t i = 0; i < m_segmentFrameTimes.size(); ++i)
+        {
+            const FrameTimeHistogram& frameTimes = m_segmentFrameTimes[i];
+
+            SegmentBenchmarkData segmentData;
+            segmentData.m_name = m_cameraPath.m_segments[i].m_name;
+            segmentData.m_frameCount = frameTimes.GetCount();
+            segmentData.m_averageFrameTime = frameTimes.GetMean();
+            segmentData.m_frameTimeStdDev = frameTimes.GetStandardDeviation();
+            segmentData.m_50pFramesUnder = static_cast<float>(frameTimes.GetQuantile(0.5));
+            segmentData.m_90pFramesUnder = static_cast<float>(frameTimes.GetQuantile(0.9));
+            segmentData.m_99pFramesUnder = static_cast<float>(frameTimes.GetQuantile(0.99));
+            segmentData.m_maxFrameTime = static_cast<float>(frameTimes.GetMax());
+
+            // Hitches use the threshold of the whole run so segments can be compared with each other
+            segmentData.m_hitchCount = frameTimes.GetCountAbove(data.m_hitchThresholdMs);
+            data.m_segments.emplace_back(AZStd::move(segmentData));
+        }
+    }
+
+    void BenchmarkHarness::BenchmarkRunEnd()
+    {
+        Utils::ToggleRadTMCapture();
+
+        FinalizeRunBenchmarkData();
+
+        const AZStd::string filePathBase = GetResultFilePathBase("Run");
+
+        const AZStd::string xmlFilePath = filePathBase + ".xml";
+        if (!AZ::Utils::SaveObjectToFile(xmlFilePath, AZ::DataStream::ST_XML, &m_currentRunBenchmarkData))
+        {
+            AZ_Error("BenchmarkHarness", false, "Failed to save benchmark run data to file %s", xmlFilePath.c_str());
+        }
+
+        const AZStd::string jsonFilePath = filePathBase + ".json";
+        if (!AZ::JsonSerializationUtils::SaveObjectToFile(&m_currentRunBenchmarkData, jsonFilePath).IsSuccess())
+        {
+            AZ_Error("BenchmarkHarness", false, "Failed to save benchmark run data to file %s", jsonFilePath.c_str());
+        }
+
+        SaveRunBenchmarkDataCsv(filePathBase + ".csv");
+        if (!m_currentRunBenchmarkData.m_segments.empty())
+        {
+            SaveSegmentBenchmarkDataCsv(filePathBase + "_segments.csv");
+        }
+
+        m_phase = Phase::Finished;
+    }
+
+    void BenchmarkHarness::UpdateCameraPath()
+    {
+        if (m_cameraPath.m_keys.size() < 2)
+        {
+            return;
+        }
+
+        // The camera holds the start of the path during warm-up
+        const AZ::u64 frame = m_phase == Phase::Recording ? m_runFrameIndex : 0;
+        const AZ::Transform transform = m_cameraPath.GetTransform(m_cameraPath.GetTimeAtFrame(frame));
+
+        AZ::TransformBus::Event(m_config.m_cameraEntityId, &AZ::TransformBus::Events::SetWorldTM, transform);
+    }
+
+    AZStd::string BenchmarkHarness::GetResultFilePathBase(const char* phaseName) const
+    {
+        const AZStd::string unresolvedPath = AZStd::string::format("@user@/benchmarks/%s%s_%ld", m_config.m_outputName.c_str(), phaseName, time(0));
+
+        char resolvedPath[AZ_MAX_PATH_LEN] = { 0 };
+        AZ::IO::FileIOBase::GetInstance()->ResolvePath(unresolvedPath.c_str(), resolvedPath, AZ_MAX_PATH_LEN);
+        return resolvedPath;
+    }
+
+    void BenchmarkHarness::SaveRunBenchmarkDataCsv(const AZStd::string& filePath) const
+    {
+        const RunBenchmarkData& data = m_currentRunBenchmarkData;
+
+        AZStd::string contents =
+            "Name,WarmupFrameCount,FrameCount,TimeInSeconds,TimeToFirstFrame,AverageFrameTime,FrameTimeStdDev,"
+            "P50FrameTime,P90FrameTime,P95FrameTime,P99FrameTime,P999FrameTime,MinFrameTime,MaxFrameTime,"
+            "AverageFrameRate,MinFrameRate,MaxFrameRate,HitchThreshold,HitchCount\n";
+        contents += AZStd::string::format("%s,%llu,%llu,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%llu\n",
+            data.m_name.c_str(), data.m_warmupFrameCount, data.m_frameCount, data.m_timeInSeconds, data.m_timeToFirstFrame,
+            data.m_averageFrameTime, data.m_frameTimeStdDev,
+            data.m_50pFramesUnder, data.m_90pFramesUnder, data.m_95pFramesUnder, data.m_99pFramesUnder, data.m_999pFramesUnder,
+            data.m_minFrameTime, data.m_maxFrameTime, data.m_averageFrameRate, data.m_minFrameRate, data.m_maxFrameRate,
+            data.m_hitchThresholdMs, data.m_hitchCount);
+
+        if (!AZ::Utils::WriteFile(contents, filePath).IsSuccess())
+        {
+            AZ_Error("BenchmarkHarness", false, "Failed to save benchmark run data to file %s", filePath.c_str());
+        }
+    }
+
+    void BenchmarkHarness::SaveSegmentBenchmarkDataCsv(const AZStd::string& filePath) const
+    {
+        AZStd::string contents = "Segment,FrameCount,AverageFrameTime,FrameTimeStdDev,P50FrameTime,P90FrameTime,P99FrameTime,MaxFrameTime,HitchCount\n";
+        for (const SegmentBenchmarkData& segment : m_currentRunBenchmarkData.m_segments)
+        {
+            contents += AZStd::string::format("%s,%llu,%f,%f,%f,%f,%f,%f,%llu\n",
+                segment.m_name.c_str(), segment.m_frameCount, segment.m_averageFrameTime, segment.m_frameTimeStdDev,
+                segment.m_50pFramesUnder, segment.m_90pFramesUnder, segment.m_99pFramesUnder, segment.m_maxFrameTime,
+                segment.m_hitchCount);
+        }
+
+        if (!AZ::Utils::WriteFile(contents, filePath).IsSuccess())
+        {
+            AZ_Error("BenchmarkHarness", false, "Failed to save benchmark segment data to file %s", filePath.c_str());
+        }
+    }
+
+    void BenchmarkHarness::DisplayResults(float deltaTime)
+    {
+        const AzFramework::WindowSize windowSize = GetRenderResolution();
+
+        const float halfWindowWidth = windowSize.m_width * 0.5f;
+        const float halfWindowHeight = windowSize.m_height * 0.5f;
+
+        const float frameTimeWindowWidth = static_cast<float>(windowSize.m_width);
+        const float frameTimeWindowHeight = 200.0f;
+
+        if (m_firstResultsDisplay)
+        {
+            ImGui::SetNextWindowPos(ImVec2(0.0f, windowSize.m_height - frameTimeWindowHeight));
+            ImGui::SetNextWindowSize(ImVec2(frameTimeWindowWidth, frameTimeWindowHeight));
+        }
+
+        if (ImGui::Begin("Frame Times"))
+        {
+            m_frameTimeHistory.Tick(deltaTime, ImGuiHistogramQueue::WidgetSettings{false, "ms"});
+        }
+        ImGui::End();
+
+        const float resultWindowWidth = 500.0f;
+        const float resultWindowHeight = 350.0f;
+
+        const float halfResultWindowWidth = resultWindowWidth * 0.5f;
+        const float halfResultWindowHeight = resultWindowHeight * 0.5f;
+
+        if (m_firstResultsDisplay)
+        {
+            ImGui::SetNextWindowPos(ImVec2(halfWindowWidth - halfResultWindowWidth,
+                halfWindowHeight - halfResultWindowHeight));
+            ImGui::SetNextWindowSize(ImVec2(resultWindowWidth, resultWindowHeight));
+
+            m_firstResultsDisplay = false;
+        }
+
+        if (ImGui::Begin("Results"))
+        {
+            ImGui::Text("%s", m_config.m_name.c_str());
+            ImGui::Separator();
+
+            ImGui::Columns(2);
+
+            ImGui::Text("Load");
+            ImGui::NextColumn();
+            ImGui::Text("Run");
+            ImGui::Separator();
+
+            ImGui::NextColumn();
+
+            ImGui::Text("File Count: %llu", m_currentLoadBenchmarkData.m_numFilesLoaded);
+            ImGui::Text("Total Time: %f seconds", m_currentLoadBenchmarkData.m_timeInSeconds);
+            ImGui::Text("Loaded: %f MB", m_currentLoadBenchmarkData.m_totalMBLoaded);
+            ImGui::Text("Throughput: %f MB/s", m_currentLoadBenchmarkData.m_mbPerSec);
+
+            ImGui::NextColumn();
+
+            ImGui::Text("Warm-up Frames: %llu", m_currentRunBenchmarkData.m_warmupFrameCount);
+            ImGui::Text("Frame Count: %llu", m_currentRunBenchmarkData.m_frameCount);
+            ImGui::Text("Total Time: %f seconds", m_currentRunBenchmarkData.m_timeInSeconds);
+            ImGui::Text("Time to First Frame: %f seconds", m_currentRunBenchmarkData.m_timeToFirstFrame);
+            ImGui::Text("Average Frame Time: %f ms", m_currentRunBenchmarkData.m_averageFrameTime);
+            ImGui::Text("50%% Frames Under: %f ms", m_currentRunBenchmarkData.m_50pFramesUnder);
+            ImGui::Text("90%% Frames Under: %f ms", m_currentRunBenchmarkData.m_90pFramesUnder);
+            ImGui::Text("95%% Frames Under: %f ms", m_currentRunBenchmarkData.m_95pFramesUnder);
+            ImGui::Text("99%% Frames Under: %f ms", m_currentRunBenchmarkData.m_99pFramesUnder);
+            ImGui::Text("99.9%% Frames Under: %f ms", m_currentRunBenchmarkData.m_999pFramesUnder);
+            ImGui::Text("Frame Time Std Dev: %f ms", m_currentRunBenchmarkData.m_frameTimeStdDev);
+            ImGui::Text("Min Frame Time: %f ms", m_currentRunBenchmarkData.m_minFrameTime);
+            ImGui::Text("Max Frame Time: %f ms", m_currentRunBenchmarkData.m_maxFrameTime);
+            ImGui::Text("Average Frame Rate: %f Hz", m_currentRunBenchmarkData.m_averageFrameRate);
+            ImGui::Text("Min Frame Rate: %f Hz", m_currentRunBenchmarkData.m_minFrameRate);
+            ImGui::Text("Max Frame Rate: %f Hz", m_currentRunBenchmarkData.m_maxFrameRate);
+            ImGui::Text("Hitches (> %.2f ms): %llu", m_currentRunBenchmarkData.m_hitchThresholdMs, m_currentRunBenchmarkData.m_hitchCount);
+
+            ImGui::Columns(1);
+
+            if (!m_currentRunBenchmarkData.m_segments.empty())
+            {
+                ImGui::Separator();
+                ImGui::Columns(5);
+                ImGui::Text("Segment");
+                ImGui::NextColumn();
+                ImGui::Text("Frames");
+                ImGui::NextColumn();
+                ImGui::Text("Average");
+                ImGui::NextColumn();
+                ImGui::Text("99%%");
+                ImGui::NextColumn();
+                ImGui::Text("Hitches");
+                ImGui::NextColumn();
+                ImGui::Separator();
+
+                for (const SegmentBenchmarkData& segment : m_currentRunBenchmarkData.m_segments)
+                {
+                    ImGui::Text("%s", segment.m_name.c_str());
+                    ImGui::NextColumn();
+                    ImGui::Text("%llu", segment.m_frameCount);
+                    ImGui::NextColumn();
+                    ImGui::Text("%.2f ms", segment.m_averageFrameTime);
+                    ImGui::NextColumn();
+                    ImGui::Text("%.2f ms", segment.m_99pFramesUnder);
+                    ImGui::NextColumn();
+                    ImGui::Text("%llu", segment.m_hitchCount);
+                    ImGui::NextColumn();
+                }
+            }
+        }
+        ImGui::Columns(1);
+        ImGui::End();
+    }
+} // namespace AtomSampleViewer
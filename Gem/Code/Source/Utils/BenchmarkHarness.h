@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+#include <Utils/CameraPath.h>
+#include <Utils/FrameTimeHistogram.h>
+#include <Utils/ImGuiHistogramQueue.h>
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace AtomSampleViewer
+{
+    //! Measures how long a sample takes to load and how fast it runs afterwards, and saves the results with a common schema
+    //! so the numbers can be compared across samples. A sample owns a BenchmarkHarness and drives it through its phases:
+    //!  - BenchmarkLoadStart() when the sample starts loading its content and BenchmarkLoadEnd() once it's ready,
+    //!    unless the harness was given the assets to wait for.
+    //!  - Tick() every frame. After loading, the harness waits for the warm-up frames, then records the run while
+    //!    optionally playing back a camera path, and finally displays the results.
+    //!    Frames are also reported for each named segment of the camera path, to localize regressions to a region of the scene.
+    //! Results are saved to "@user@/benchmarks/<outputName>Load_<time>.xml|json" and "<outputName>Run_<time>.xml|json|csv".
+    //!
+    //! Dedicated benchmark samples call Activate(). Other samples call ActivateIfRequested() so they only run the benchmark
+    //! when the "-benchmark" command line switch is given. The switch takes an optional number of frames to record, and
+    //! "-benchmarkWarmup <frames>" overrides the number of warm-up frames, and "-benchmarkCameraPath <product path>"
+    //! overrides the camera path asset.
+    class BenchmarkHarness final
+        : public AZ::Data::AssetBus::MultiHandler
+    {
+    public:
+        struct Config
+        {
+            AZStd::string m_name;           //!< Display name of the benchmark, e.g. "Sponza"
+            AZStd::string m_outputName;     //!< Prefix of the result files, e.g. "sponza"
+            AZ::EntityId m_cameraEntityId;  //!< The camera that follows the camera path
+            AZ::u64 m_warmupFrames = DefaultWarmupFrames;
+            AZ::u64 m_runFrames = 0;        //!< The number of frames to record. 0 records until the end of the camera path.
+            AZStd::string m_cameraPathAsset; //!< Product path of a camera path asset. The camera is left to the sample when this is empty.
+        };
+
+        struct LoadBenchmarkData
+        {
+            AZ_TYPE_INFO(LoadBenchmarkData, "{8677FEAB-EBA6-468A-97CB-AAF1B16F5FE2}");
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            struct FileLoadedData
+            {
+                AZ_TYPE_INFO(FileLoadedData, "{F4E5728D-C526-4C28-83BA-D4B07DC894E8}");
+
+                static void Reflect(AZ::ReflectContext* context);
+
+                AZStd::string m_relativePath;
+                AZ::u64 m_bytesLoaded = 0;
+            };
+
+            AZStd::string m_name = "";
+            double m_timeInSeconds = 0.0;
+            double m_totalMBLoaded = 0.0;
+            double m_mbPerSec = 0.0;
+            AZ::u64 m_numFilesLoaded = 0;
+            AZStd::vector<FileLoadedData> m_filesLoaded;
+        };
+
+        //! Frame time statistics for the frames recorded while the camera was in one segment of the camera path
+        struct SegmentBenchmarkData
+        {
+            AZ_TYPE_INFO(SegmentBenchmarkData, "{6B0E3C5A-2F71-4D8E-9A14-C5E7B3D90F28}");
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            AZStd::string m_name;
+            AZ::u64 m_frameCount = 0;
+            double m_averageFrameTime = 0.0;
+            double m_frameTimeStdDev = 0.0;
+            float m_50pFramesUnder = 0.0f;
+            float m_90pFramesUnder = 0.0f;
+            float m_99pFramesUnder = 0.0f;
+            float m_maxFrameTime = 0.0f;
+            AZ::u64 m_hitchCount = 0;
+        };
+
+        struct RunBenchmarkData
+        {
+            AZ_TYPE_INFO(RunBenchmarkData, "{45FFA85B-1224-4558-B833-3D8A4404041C}");
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            AZStd::string m_name;
+            AZ::u64 m_warmupFrameCount = 0;
+            AZ::u64 m_frameCount = 0;
+            double m_timeInSeconds = 0.0;
+            double m_timeToFirstFrame = 0.0;  //!< Seconds from the end of loading to the first recorded frame
+            double m_averageFrameTime = 0.0;
+            double m_frameTimeStdDev = 0.0;
+            float m_50pFramesUnder = 0.0f;
+            float m_90pFramesUnder = 0.0f;
+            float m_95pFramesUnder = 0.0f;
+            float m_99pFramesUnder = 0.0f;
+            float m_999pFramesUnder = 0.0f;
+            float m_minFrameTime = FLT_MAX;
+            float m_maxFrameTime = FLT_MIN;
+
+            float m_averageFrameRate = 0.0;
+            float m_minFrameRate = FLT_MAX;
+            float m_maxFrameRate = FLT_MIN;
+
+            //! Frames that took longer than HitchMedianMultiplier times the median frame time
+            AZ::u64 m_hitchCount = 0;
+            float m_hitchThresholdMs = 0.0f;
+
+            AZStd::vector<SegmentBenchmarkData> m_segments;
+        };
+
+        static constexpr AZ::u64 DefaultWarmupFrames = 100;
+        static constexpr AZ::u64 DefaultRunFrames = 1000;
+
+        //! A frame counts as a hitch when it takes this many times longer than the median frame
+        static constexpr float HitchMedianMultiplier = 2.0f;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Returns true if the "-benchmark" command line switch was given.
+        static bool IsBenchmarkRequested();
+
+        BenchmarkHarness() = default;
+        ~BenchmarkHarness() override;
+
+        //! Enables the harness. The command line switches override the frame counts in the config.
+        void Activate(const Config& config);
+
+        //! Enables the harness only if the "-benchmark" command line switch was given.
+        void ActivateIfRequested(const Config& config);
+
+        void Deactivate();
+
+        bool IsActive() const { return m_phase != Phase::Inactive; }
+        bool IsLoading() const { return m_phase == Phase::Loading; }
+        bool IsRecording() const { return m_phase == Phase::Recording; }
+        bool IsFinished() const { return m_phase == Phase::Finished; }
+
+        //! Starts timing the load. Loading ends when all the given assets are ready, or when BenchmarkLoadEnd() is called if none are given.
+        void BenchmarkLoadStart(const AZStd::vector<AZ::Data::AssetId>& assetsToWaitFor = {});
+        void BenchmarkLoadEnd();
+
+        //! Advances the benchmark by one frame. Must be called every frame once loading has ended.
+        void Tick(float deltaTime, AZ::ScriptTimePoint timePoint);
+
+        //! Returns the index of the frame that will be recorded by the next Tick().
+        AZ::u64 GetRunFrameIndex() const { return m_runFrameIndex; }
+
+        const LoadBenchmarkData& GetLoadBenchmarkData() const { return m_currentLoadBenchmarkData; }
+        const RunBenchmarkData& GetRunBenchmarkData() const { return m_currentRunBenchmarkData; }
+
+    private:
+        enum class Phase
+        {
+            Inactive,
+            Idle,
+            Loading,
+            WarmUp,
+            Recording,
+            Finished
+        };
+
+        // AZ::Data::AssetBus::Handler
+        void OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+
+        void FinalizeLoadBenchmarkData();
+
+        void BenchmarkRunStart(AZ::ScriptTimePoint timePoint);
+        void CollectRunBenchmarkData(float deltaTime, AZ::ScriptTimePoint timePoint);
+        void FinalizeRunBenchmarkData();
+        void BenchmarkRunEnd();
+
+        void UpdateCameraPath();
+
+        //! Returns the resolved path of a result file without extension, for the given phase ("Load" or "Run").
+        AZStd::string GetResultFilePathBase(const char* phaseName) const;
+        void SaveRunBenchmarkDataCsv(const AZStd::string& filePath) const;
+        void SaveSegmentBenchmarkDataCsv(const AZStd::string& filePath) const;
+
+        void DisplayResults(float deltaTime);
+
+        Config m_config;
+        CameraPath m_cameraPath;
+        Phase m_phase = Phase::Inactive;
+
+        AZStd::vector<AZ::Data::AssetId> m_assetsToWaitFor;
+
+        double m_loadStartTime = 0.0;  //!< UTC milliseconds
+        double m_loadEndTime = 0.0;    //!< UTC milliseconds
+        double m_runStartTimePoint = 0.0;
+
+        AZ::u64 m_warmupFramesRemaining = 0;
+        AZ::u64 m_runFrameIndex = 0;
+
+        LoadBenchmarkData m_currentLoadBenchmarkData;
+        RunBenchmarkData m_currentRunBenchmarkData;
+
+        //! Frame time statistics for the current run, in constant memory so long soak runs don't grow
+        FrameTimeHistogram m_runFrameTimes;
+        AZStd::vector<FrameTimeHistogram> m_segmentFrameTimes;
+
+        //! Bounded log of the latest frame times, for display only
+        ImGuiHistogramQueue m_frameTimeHistory = ImGuiHistogramQueue(10000, 60);
+
+        bool m_firstResultsDisplay = true;
+    };
+} // namespace AtomSampleViewer
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/CameraPath.h>
+
+#include <Atom/RPI.Reflect/Asset/AssetUtils.h>
+#include <Atom/RPI.Reflect/System/AnyAsset.h>
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+
+namespace AtomSampleViewer
+{
+    void CameraPathKey::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<CameraPathKey>()
+                ->Version(0)
+                ->Field("time", &CameraPathKey::m_time)
+                ->Field("position", &CameraPathKey::m_position)
+                ->Field("target", &CameraPathKey::m_target)
+                ;
+        }
+    }
+
+    void CameraPathSegment::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<CameraPathSegment>()
+                ->Version(0)
+                ->Field("name", &CameraPathSegment::m_name)
+                ->Field("startTime", &CameraPathSegment::m_startTime)
+                ;
+        }
+    }
+
+    void CameraPath::Reflect(AZ::ReflectContext* context)
+    {
+        CameraPathKey::Reflect(context);
+        CameraPathSegment::Reflect(context);
+
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Enum<CameraPath::Timing>()
+                ->Value("FrameIndex", CameraPath::Timing::FrameIndex)
+                ->Value("FixedTimestep", CameraPath::Timing::FixedTimestep)
+                ;
+
+            serializeContext->Enum<CameraPath::Interpolation>()
+                ->Value("Linear", CameraPath::Interpolation::Linear)
+                ->Value("CatmullRom", CameraPath::Interpolation::CatmullRom)
+                ;
+
+            serializeContext->Class<CameraPath>()
+                ->Version(0)
+                ->Field("timing", &CameraPath::m_timing)
+                ->Field("timestep", &CameraPath::m_timestep)
+                ->Field("interpolation", &CameraPath::m_interpolation)
+                ->Field("keys", &CameraPath::m_keys)
+                ->Field("segments", &CameraPath::m_segments)
+                ;
+        }
+    }
+
+    AZ::Outcome<CameraPath, AZStd::string> CameraPath::LoadFromAsset(const AZStd::string& productPath)
+    {
+        AZ::Data::Asset<AZ::RPI::AnyAsset> asset =
+            AZ::RPI::AssetUtils::LoadAssetByProductPath<AZ::RPI::AnyAsset>(productPath.c_str(), AZ::RPI::AssetUtils::TraceLevel::Error);
+        if (!asset)
+        {
+            return AZ::Failure(AZStd::string::format("Could not load camera path '%s'.", productPath.c_str()));
+        }
+
+        const CameraPath* loadedPath = asset->GetDataAs<CameraPath>();
+        if (!loadedPath)
+        {
+            return AZ::Failure(AZStd::string::format("'%s' is not a camera path.", productPath.c_str()));
+        }
+
+        CameraPath path = *loadedPath;
+        auto validateOutcome = path.Validate();
+        if (!validateOutcome.IsSuccess())
+        {
+            return AZ::Failure(AZStd::string::format("Camera path '%s' is invalid. %s", productPath.c_str(), validateOutcome.GetError().c_str()));
+        }
+
+        return AZ::Success(AZStd::move(path));
+    }
+
+    AZ::Outcome<void, AZStd::string> CameraPath::Validate()
+    {
+        if (m_keys.size() < 2)
+        {
+            return AZ::Failure(AZStd::string("A camera path needs at least 2 keys."));
+        }
+
+        if (m_timing == Timing::FixedTimestep && m_timestep <= 0.0f)
+        {
+            return AZ::Failure(AZStd::string("The timestep must be greater than 0."));
+        }
+
+        AZStd::stable_sort(m_keys.begin(), m_keys.end(), [](const CameraPathKey& a, const CameraPathKey& b) { return a.m_time < b.m_time; });
+        AZStd::stable_sort(m_segments.begin(), m_segments.end(), [](const CameraPathSegment& a, const CameraPathSegment& b) { return a.m_startTime < b.m_startTime; });
+
+        for (size_t i = 1; i < m_keys.size(); ++i)
+        {
+            if (m_keys[i].m_time <= m_keys[i - 1].m_time)
+            {
+                return AZ::Failure(AZStd::string::format("Keys %zu and %zu have the same time %f.", i - 1, i, m_keys[i].m_time));
+            }
+        }
+
+        return AZ::Success();
+    }
+
+    float CameraPath::GetTimeAtFrame(AZ::u64 frameIndex) const
+    {
+        return m_timing == Timing::FrameIndex ? static_cast<float>(frameIndex) : static_cast<float>(frameIndex) * m_timestep;
+    }
+
+    AZ::u64 CameraPath::GetFrameCount() const
+    {
+        if (m_keys.empty())
+        {
+            return 0;
+        }
+
+        const float duration = m_keys.back().m_time;
+        return static_cast<AZ::u64>(AZStd::ceil(m_timing == Timing::FrameIndex ? duration : duration / m_timestep));
+    }
+
+    void CameraPath::Evaluate(float time, AZ::Vector3& position, AZ::Vector3& target) const
+    {
+        AZ_Assert(m_keys.size() >= 2, "Camera path must be validated before it's evaluated.");
+
+        time = AZStd::clamp(time, m_keys.front().m_time, m_keys.back().m_time);
+
+        // Find the keys around the time
+        auto nextKey = AZStd::upper_bound(m_keys.begin(), m_keys.end(), time, [](float t, const CameraPathKey& key) { return t < key.m_time; });
+        const size_t i1 = AZStd::min(static_cast<size_t>(nextKey - m_keys.begin()), m_keys.size() - 1);
+        const size_t i0 = i1 - 1;
+
+        const CameraPathKey& key0 = m_keys[i0];
+        const CameraPathKey& key1 = m_keys[i1];
+        const float span = key1.m_time - key0.m_time;
+        const float s = (time - key0.m_time) / span;
+
+        if (m_interpolation == Interpolation::Linear)
+        {
+            position = key0.m_position.Lerp(key1.m_position, s);
+            target = key0.m_target.Lerp(key1.m_target, s);
+            return;
+        }
+
+        // Catmull-Rom tangents are the velocity between the neighboring keys, using one-sided differences at the ends of the path
+        const size_t iPrev = i0 > 0 ? i0 - 1 : i0;
+        const size_t iNext = i1 + 1 < m_keys.size() ? i1 + 1 : i1;
+        const float tangentSpan0 = m_keys[i1].m_time - m_keys[iPrev].m_time;
+        const float tangentSpan1 = m_keys[iNext].m_time - m_keys[i0].m_time;
+
+        // Cubic Hermite basis functions, with the tangents scaled from per-time to per-span units
+        const float s2 = s * s;
+        const float s3 = s2 * s;
+        const float h00 = 2.0f * s3 - 3.0f * s2 + 1.0f;
+        const float h10 = (s3 - 2.0f * s2 + s) * span;
+        const float h01 = -2.0f * s3 + 3.0f * s2;
+        const float h11 = (s3 - s2) * span;
+
+        auto interpolate = [&](AZ::Vector3 CameraPathKey::*member)
+        {
+            const AZ::Vector3 tangent0 = (m_keys[i1].*member - m_keys[iPrev].*member) / tangentSpan0;
+            const AZ::Vector3 tangent1 = (m_keys[iNext].*member - m_keys[i0].*member) / tangentSpan1;
+            return key0.*member * h00 + tangent0 * h10 + key1.*member * h01 + tangent1 * h11;
+        };
+
+        position = interpolate(&CameraPathKey::m_position);
+        target = interpolate(&CameraPathKey::m_target);
+    }
+
+    AZ::Transform CameraPath::GetTransform(float time) const
+    {
+        AZ::Vector3 position;
+        AZ::Vector3 target;
+        Evaluate(time, position, target);
+        return AZ::Transform::CreateLookAt(position, target, AZ::Transform::Axis::YPositive);
+    }
+
+    int CameraPath::GetSegmentIndex(float time) const
+    {
+        auto nextSegment = AZStd::upper_bound(m_segments.begin(), m_segments.end(), time,
+            [](float t, const CameraPathSegment& segment) { return t < segment.m_startTime; });
+        return static_cast<int>(nextSegment - m_segments.begin()) - 1;
+    }
+
+} // namespace AtomSampleViewer
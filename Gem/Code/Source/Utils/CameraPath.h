@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace AtomSampleViewer
+{
+    struct CameraPathKey
+    {
+        AZ_TYPE_INFO(AtomSampleViewer::CameraPathKey, "{0C1B8E4F-5E0B-4B8A-9D9F-2C7A3B5E6D41}")
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        float m_time = 0.0f;  //!< In frames or seconds, depending on the path's timing
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_target = AZ::Vector3::CreateAxisY();
+    };
+
+    //! A named part of a camera path, used to report statistics for a region of the scene.
+    struct CameraPathSegment
+    {
+        AZ_TYPE_INFO(AtomSampleViewer::CameraPathSegment, "{5A3F9D27-8C64-4E0B-A1C2-7B9E0D4F3A18}")
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZStd::string m_name;
+        float m_startTime = 0.0f;  //!< The segment lasts until the next segment starts or the path ends
+    };
+
+    //! A camera animation made of timed keys, loaded from a "*.camerapath.azasset" file.
+    //! The camera position and look-at target are interpolated separately, so the camera can look at a fixed point while moving.
+    struct CameraPath final
+    {
+        AZ_TYPE_INFO(AtomSampleViewer::CameraPath, "{E4B7C2A9-1D3F-4A6E-8B05-9C2D7F1E3B64}")
+
+        enum class Timing : uint32_t
+        {
+            FrameIndex,     //!< Key times are frame indices
+            FixedTimestep   //!< Key times are seconds, and every frame advances by m_timestep
+        };
+
+        enum class Interpolation : uint32_t
+        {
+            Linear,
+            CatmullRom      //!< Passes through every key with a continuous velocity. Tangents account for uneven key spacing.
+        };
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Loads a camera path asset by product path, e.g. "config/camerapaths/sponza_exterior.camerapath.azasset".
+        static AZ::Outcome<CameraPath, AZStd::string> LoadFromAsset(const AZStd::string& productPath);
+
+        //! Sorts the keys and segments by time and returns an error if the path can't be played.
+        AZ::Outcome<void, AZStd::string> Validate();
+
+        //! Returns the path time to use for a frame index.
+        float GetTimeAtFrame(AZ::u64 frameIndex) const;
+
+        //! Returns the number of frames it takes to play the whole path.
+        AZ::u64 GetFrameCount() const;
+
+        void Evaluate(float time, AZ::Vector3& position, AZ::Vector3& target) const;
+
+        //! Returns a transform at the interpolated position, looking at the interpolated target.
+        AZ::Transform GetTransform(float time) const;
+
+        //! Returns the index of the segment that contains the time, or -1 if the time is before every segment.
+        int GetSegmentIndex(float time) const;
+
+        Timing m_timing = Timing::FrameIndex;
+        float m_timestep = 1.0f / 60.0f;  //!< Seconds per frame, for Timing::FixedTimestep
+        Interpolation m_interpolation = Interpolation::CatmullRom;
+        AZStd::vector<CameraPathKey> m_keys;
+        AZStd::vector<CameraPathSegment> m_segments;
+    };
+
+} // namespace AtomSampleViewer
+
+namespace AZ
+{
+    AZ_TYPE_INFO_SPECIALIZE(AtomSampleViewer::CameraPath::Timing, "{8F2E6B1D-3C47-4D95-A0B8-6E1F2C9D7A35}");
+    AZ_TYPE_INFO_SPECIALIZE(AtomSampleViewer::CameraPath::Interpolation, "{B1D4A7E3-9F26-4C58-8E0A-3D7C5B2F1E96}");
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/FrameTimeHistogram.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace AtomSampleViewer
+{
+    size_t FrameTimeHistogram::GetBucketIndex(AZ::u64 microseconds)
+    {
+        microseconds = AZStd::min<AZ::u64>(microseconds, (1ull << MaxValueBits) - 1);
+        if (microseconds < SubBucketCount)
+        {
+            return static_cast<size_t>(microseconds);
+        }
+
+        // Shift the value so it lands in the upper half of the sub-buckets; each extra bit of magnitude adds half a sub-bucket range.
+        const AZ::u32 highestBit = 63 - az_clz_u64(microseconds);
+        const AZ::u32 shift = highestBit - (SubBucketBits - 1);
+        return static_cast<size_t>(SubBucketHalfCount * shift + (microseconds >> shift));
+    }
+
+    AZ::u64 FrameTimeHistogram::GetBucketLowerBound(size_t bucketIndex)
+    {
+        if (bucketIndex < SubBucketCount)
+        {
+            return bucketIndex;
+        }
+
+        const AZ::u64 shift = bucketIndex / SubBucketHalfCount - 1;
+        return (bucketIndex - SubBucketHalfCount * shift) << shift;
+    }
+
+    AZ::u64 FrameTimeHistogram::GetBucketWidth(size_t bucketIndex)
+    {
+        return bucketIndex < SubBucketCount ? 1 : 1ull << (bucketIndex / SubBucketHalfCount - 1);
+    }
+
+    void FrameTimeHistogram::PushValue(float milliseconds)
+    {
+        const double value = AZStd::max(static_cast<double>(milliseconds), 0.0);
+
+        ++m_buckets[GetBucketIndex(static_cast<AZ::u64>(value * 1000.0 + 0.5))];
+
+        if (m_count == 0)
+        {
+            m_min = value;
+            m_max = value;
+        }
+        else
+        {
+            m_min = AZStd::min(m_min, value);
+            m_max = AZStd::max(m_max, value);
+        }
+
+        ++m_count;
+        const double delta = value - m_mean;
+        m_mean += delta / static_cast<double>(m_count);
+        m_sumOfSquaredDeviations += delta * (value - m_mean);
+
+        if (value > 0.0)
+        {
+            m_frameRateSum += 1000.0 / value;
+        }
+    }
+
+    void FrameTimeHistogram::Reset()
+    {
+        *this = FrameTimeHistogram();
+    }
+
+    double FrameTimeHistogram::GetStandardDeviation() const
+    {
+        return m_count > 1 ? AZStd::sqrt(m_sumOfSquaredDeviations / static_cast<double>(m_count - 1)) : 0.0;
+    }
+
+    double FrameTimeHistogram::GetQuantile(double fraction) const
+    {
+        if (m_count == 0)
+        {
+            return 0.0;
+        }
+
+        const AZ::u64 rank = AZStd::clamp<AZ::u64>(static_cast<AZ::u64>(AZStd::ceil(fraction * static_cast<double>(m_count))), 1, m_count);
+
+        AZ::u64 countSoFar = 0;
+        for (size_t i = 0; i < BucketCount; ++i)
+        {
+            countSoFar += m_buckets[i];
+            if (countSoFar >= rank)
+            {
+                // Report the middle of the bucket, which halves the error compared to either of its bounds
+                const double microseconds = static_cast<double>(GetBucketLowerBound(i)) + static_cast<double>(GetBucketWidth(i) - 1) * 0.5;
+                return AZStd::clamp(microseconds / 1000.0, m_min, m_max);
+            }
+        }
+
+        return m_max;
+    }
+
+    AZ::u64 FrameTimeHistogram::GetCountAbove(double milliseconds) const
+    {
+        const AZ::u64 thresholdMicroseconds = static_cast<AZ::u64>(AZStd::max(milliseconds, 0.0) * 1000.0);
+
+        AZ::u64 count = 0;
+        for (size_t i = GetBucketIndex(thresholdMicroseconds) + 1; i < BucketCount; ++i)
+        {
+            count += m_buckets[i];
+        }
+        return count;
+    }
+
+} // namespace AtomSampleViewer
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/array.h>
+
+namespace AtomSampleViewer
+{
+    //! Accumulates frame time statistics in constant memory, no matter how many frames are recorded.
+    //! Values are counted in log-linear buckets (as in an HDR histogram) with microsecond resolution and a relative error
+    //! below 1%, which is enough to estimate any quantile. Count, min, max, mean and standard deviation are exact.
+    class FrameTimeHistogram
+    {
+    public:
+        //! Adds a frame time in milliseconds. Times beyond about 70 minutes are counted in the last bucket.
+        void PushValue(float milliseconds);
+
+        void Reset();
+
+        AZ::u64 GetCount() const { return m_count; }
+        double GetMin() const { return m_count ? m_min : 0.0; }
+        double GetMax() const { return m_count ? m_max : 0.0; }
+        double GetMean() const { return m_mean; }
+        double GetStandardDeviation() const;
+
+        //! Mean of the per-frame rates (1000 / frame time), in Hz.
+        double GetMeanFrameRate() const { return m_count ? m_frameRateSum / static_cast<double>(m_count) : 0.0; }
+
+        //! Returns the value that the given fraction of frames are at or under, e.g. 0.99 for the 99th percentile.
+        double GetQuantile(double fraction) const;
+
+        //! Returns the number of frames that took longer than the threshold, in milliseconds.
+        AZ::u64 GetCountAbove(double milliseconds) const;
+
+    private:
+        //! Each power of two range is split into this many linear sub-buckets, which bounds the relative error to 1/SubBucketHalfCount.
+        static constexpr AZ::u32 SubBucketBits = 8;
+        static constexpr AZ::u64 SubBucketCount = 1ull << SubBucketBits;
+        static constexpr AZ::u64 SubBucketHalfCount = SubBucketCount / 2;
+        static constexpr AZ::u32 MaxValueBits = 32;
+        static constexpr size_t BucketCount = SubBucketHalfCount * (MaxValueBits - SubBucketBits + 1) + SubBucketHalfCount;
+
+        static size_t GetBucketIndex(AZ::u64 microseconds);
+        static AZ::u64 GetBucketLowerBound(size_t bucketIndex);
+        static AZ::u64 GetBucketWidth(size_t bucketIndex);
+
+        AZStd::array<AZ::u64, BucketCount> m_buckets = {};
+        AZ::u64 m_count = 0;
+        double m_min = 0.0;
+        double m_max = 0.0;
+        double m_mean = 0.0;
+        double m_sumOfSquaredDeviations = 0.0; //!< Welford's running M2, for the standard deviation
+        double m_frameRateSum = 0.0;
+    };
+
+} // namespace AtomSampleViewer
@@ -12,64 +12,153 @@
 
 namespace AtomSampleViewer
 {
+    namespace
+    {
+        //! Presents a ring of plot points to ImGui with the newest point at index 0.
+        struct PlotRing
+        {
+            const float* m_values = nullptr;
+            AZ::u64 m_newestBlock = 0;
+            AZStd::size_t m_capacity = 0;
+        };
+
+        float GetPlotRingValue(void* data, int index)
+        {
+            const PlotRing* ring = static_cast<const PlotRing*>(data);
+            return ring->m_values[(ring->m_newestBlock - index) % ring->m_capacity];
+        }
+    }
 
     ImGuiHistogramQueue::ImGuiHistogramQueue(
         AZStd::size_t maxSamples,
         AZStd::size_t runningAverageSamples,
         float numericDisplayUpdateDelay)
-        : m_maxSamples(maxSamples)
-        , m_runningAverageSamples(runningAverageSamples)
+        : m_maxSamples(AZStd::max<AZStd::size_t>(maxSamples, 1))
+        , m_runningAverageSamples(AZStd::max<AZStd::size_t>(runningAverageSamples, 1))
         , m_numericDisplayDelay(numericDisplayUpdateDelay)
+        , m_plotDecimation((m_maxSamples + PlotWidth - 1) / PlotWidth)
+        , m_plotCapacity((m_maxSamples + m_plotDecimation - 1) / m_plotDecimation)
     {
         AZ_Assert(m_maxSamples >= m_runningAverageSamples, "maxSamples must be larger");
 
-        m_valueLog.reserve(m_maxSamples);
-        m_averageLog.reserve(m_maxSamples);
+        m_valueLog.resize(m_maxSamples, 0.0f);
+        m_plotValueLog.resize(m_plotCapacity, 0.0f);
+        m_plotAverageLog.resize(m_plotCapacity, 0.0f);
     }
 
-    float ImGuiHistogramQueue::UpdateDisplayedValues(AZStd::size_t maxSampleCount, float& minValue, float& maxValue)
+    AZStd::size_t ImGuiHistogramQueue::GetSampleCount() const
     {
-        size_t sampleCount = AZStd::min<size_t>(maxSampleCount, m_valueLog.size());
-        float average = 0.f;
-        if (sampleCount > 0)
+        return static_cast<AZStd::size_t>(AZStd::min<AZ::u64>(m_totalSamples, m_maxSamples));
+    }
+
+    float ImGuiHistogramQueue::GetValue(AZ::u64 sequence) const
+    {
+        return m_valueLog[sequence % m_maxSamples];
+    }
+
+    void ImGuiHistogramQueue::RebaseSums()
+    {
+        const AZStd::size_t sampleCount = GetSampleCount();
+        const AZStd::size_t runningAverageCount = AZStd::min(sampleCount, m_runningAverageSamples);
+
+        m_logSum = 0.0;
+        m_runningAverageSum = 0.0;
+        for (AZStd::size_t i = 0; i < sampleCount; ++i)
         {
-            average = m_valueLog.at(0);
-            minValue = maxValue = average;
-            for (size_t i = 1; i < sampleCount; ++i)
+            const double value = GetValue(m_totalSamples - 1 - i);
+            m_logSum += value;
+            if (i < runningAverageCount)
             {
-                float curValue = m_valueLog.at(i);
-                average += curValue;
-                minValue = minValue > curValue ? curValue : minValue;
-                maxValue = maxValue < curValue ? curValue : maxValue;
+                m_runningAverageSum += value;
             }
-            average /= sampleCount;
         }
-        return average;
+    }
+
+    void ImGuiHistogramQueue::UpdateDisplayedValues()
+    {
+        const AZStd::size_t sampleCount = GetSampleCount();
+        if (sampleCount > 0)
+        {
+            m_displayedAverage = static_cast<float>(m_logSum / static_cast<double>(sampleCount));
+            m_displayedMinimum = GetValue(m_minQueue.front());
+            m_displayedMaximum = GetValue(m_maxQueue.front());
+        }
     }
 
     void ImGuiHistogramQueue::PushValue(float value)
     {
         m_samplesSinceLastDisplayUpdate++;
 
+        const AZ::u64 sequence = m_totalSamples;
+
+        // Evict the values that fall out of the log and running average windows. This has to happen before the new value
+        // is written because it may overwrite the slot of the value being evicted.
+        if (sequence >= m_maxSamples)
+        {
+            const AZ::u64 expired = sequence - m_maxSamples;
+            m_logSum -= GetValue(expired);
+            if (m_minQueue.front() == expired)
+            {
+                m_minQueue.pop_front();
+            }
+            if (m_maxQueue.front() == expired)
+            {
+                m_maxQueue.pop_front();
+            }
+        }
+        if (sequence >= m_runningAverageSamples)
+        {
+            m_runningAverageSum -= GetValue(sequence - m_runningAverageSamples);
+        }
+
         // Update the log of all values
-        if (m_valueLog.size() == m_maxSamples)
+        m_valueLog[sequence % m_maxSamples] = value;
+        m_logSum += value;
+        m_runningAverageSum += value;
+
+        while (!m_minQueue.empty() && GetValue(m_minQueue.back()) >= value)
+        {
+            m_minQueue.pop_back();
+        }
+        m_minQueue.push_back(sequence);
+
+        while (!m_maxQueue.empty() && GetValue(m_maxQueue.back()) <= value)
+        {
+            m_maxQueue.pop_back();
+        }
+        m_maxQueue.push_back(sequence);
+
+        ++m_totalSamples;
+
+        // Running the sums for a long time accumulates rounding error, so recompute them once per wrap of the ring.
+        // This keeps the cost amortized O(1) per sample.
+        if (m_totalSamples % m_maxSamples == 0)
         {
-            m_valueLog.pop_back();
+            RebaseSums();
         }
-        m_valueLog.insert(m_valueLog.begin(), value);
 
         // Calculate running average for line graph
-        if (m_averageLog.size() == m_maxSamples)
+        const AZStd::size_t runningAverageCount = static_cast<AZStd::size_t>(AZStd::min<AZ::u64>(m_totalSamples, m_runningAverageSamples));
+        const float runningAverage = static_cast<float>(m_runningAverageSum / static_cast<double>(runningAverageCount));
+
+        // Fold the value into its plot point. Each point shows the max value and the mean running average of its block of samples.
+        const AZStd::size_t blockOffset = static_cast<AZStd::size_t>(sequence % m_plotDecimation);
+        const AZStd::size_t plotSlot = static_cast<AZStd::size_t>((sequence / m_plotDecimation) % m_plotCapacity);
+        if (blockOffset == 0)
         {
-            m_averageLog.pop_back();
+            m_plotValueLog[plotSlot] = value;
+            m_plotAverageLog[plotSlot] = runningAverage;
+        }
+        else
+        {
+            m_plotValueLog[plotSlot] = AZStd::max(m_plotValueLog[plotSlot], value);
+            m_plotAverageLog[plotSlot] += (runningAverage - m_plotAverageLog[plotSlot]) / static_cast<float>(blockOffset + 1);
         }
-        [[maybe_unused]] float minValue, maxValue; // unused required call parameters
-        m_averageLog.insert(m_averageLog.begin(), UpdateDisplayedValues(m_runningAverageSamples, minValue, maxValue));
 
         // Calculate average for numeric display
         if (m_timeSinceLastDisplayUpdate >= m_numericDisplayDelay || m_samplesSinceLastDisplayUpdate >= m_maxSamples)
         {
-            m_displayedAverage = UpdateDisplayedValues(m_maxSamples, m_displayedMinimum, m_displayedMaximum);
+            UpdateDisplayedValues();
 
             m_timeSinceLastDisplayUpdate = 0.0f;
             m_samplesSinceLastDisplayUpdate = 0;
@@ -78,7 +167,7 @@ namespace AtomSampleViewer
 
     void ImGuiHistogramQueue::Tick(float deltaTime, WidgetSettings settings)
     {
-        if (m_averageLog.empty() || m_valueLog.empty())
+        if (m_totalSamples == 0)
         {
             return;
         }
@@ -97,15 +186,21 @@ namespace AtomSampleViewer
             valueString = AZStd::string::format("avg:%4.2f %s | min:%4.2f %s | max:%4.2f %s ", m_displayedAverage, settings.m_units, m_displayedMinimum, settings.m_units, m_displayedMaximum, settings.m_units);
         }
 
+        const AZ::u64 newestBlock = (m_totalSamples - 1) / m_plotDecimation;
+        const int32_t plotCount = int32_t(AZStd::min<AZ::u64>(newestBlock + 1, m_plotCapacity));
+
+        PlotRing averageRing{ m_plotAverageLog.data(), newestBlock, m_plotCapacity };
+        PlotRing valueRing{ m_plotValueLog.data(), newestBlock, m_plotCapacity };
+
         // Draw moving average of values first
         ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.6, 0.8, 0.9, 1.0));
-        ImGui::PlotLines("##Average", &m_averageLog[0], int32_t(m_averageLog.size()), 0, nullptr, 0.0f, m_displayedAverage * 2.0f, ImVec2(400, 50));
+        ImGui::PlotLines("##Average", &GetPlotRingValue, &averageRing, plotCount, 0, nullptr, 0.0f, m_displayedAverage * 2.0f, ImVec2(static_cast<float>(PlotWidth), 50));
         ImGui::PopStyleColor();
 
         // Draw individual value bars on top of it (with no background).
         ImGui::SetCursorPos(pos);
         ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4(0, 0, 0, 0));
-        ImGui::PlotHistogram("##Value", &m_valueLog[0], int32_t(m_valueLog.size()), 0, valueString.c_str(), 0.0f, m_displayedAverage * 2.0f, ImVec2(400, 50));
+        ImGui::PlotHistogram("##Value", &GetPlotRingValue, &valueRing, plotCount, 0, valueString.c_str(), 0.0f, m_displayedAverage * 2.0f, ImVec2(static_cast<float>(PlotWidth), 50));
         ImGui::PopStyleColor();
     }
 
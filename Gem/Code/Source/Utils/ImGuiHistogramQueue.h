@@ -8,12 +8,17 @@
 
 #pragma once
 
+#include <AzCore/base.h>
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AtomSampleViewer
 {
     //! Tracks time values over multiple frames, computes the average, and draws a historgram.
-    class ImGuiHistogramQueue 
+    //! Values are stored in a ring buffer and the sum/min/max statistics are maintained incrementally, so PushValue() is O(1)
+    //! regardless of maxSamples. When the log holds more samples than the histogram is wide, consecutive samples are
+    //! decimated into one plotted point (the max value and the mean running average of the samples it covers).
+    class ImGuiHistogramQueue
     {
     public:
         //! @param maxSamples the max number of samples that can be recorded in the queue and displayed in the histogram
@@ -39,17 +44,42 @@ namespace AtomSampleViewer
 
     private:
 
-        float UpdateDisplayedValues(AZStd::size_t maxSampleCount, float& minValue, float& maxValue);
+        //! Width of the plot widgets in pixels, which is also the max number of points that are plotted.
+        static constexpr AZStd::size_t PlotWidth = 400;
 
-        AZStd::vector<float> m_valueLog;
-        AZStd::vector<float> m_averageLog;
+        AZStd::size_t GetSampleCount() const;
+        float GetValue(AZ::u64 sequence) const;
+
+        //! Recomputes the running sums from the logged values to discard accumulated floating point error.
+        void RebaseSums();
+
+        void UpdateDisplayedValues();
 
         const AZStd::size_t m_maxSamples;
         const AZStd::size_t m_runningAverageSamples;
         const float m_numericDisplayDelay;
 
+        //! Number of consecutive samples that are merged into each plotted point, and the number of plotted points kept.
+        const AZStd::size_t m_plotDecimation;
+        const AZStd::size_t m_plotCapacity;
+
+        //! Ring buffer of the last m_maxSamples values. The value with sequence number N is stored at N % m_maxSamples.
+        AZStd::vector<float> m_valueLog;
+        AZ::u64 m_totalSamples = 0;
+
+        double m_logSum = 0.0;
+        double m_runningAverageSum = 0.0;
+
+        //! Monotonic queues of sequence numbers used to track the min and max over the log window in amortized O(1).
+        AZStd::deque<AZ::u64> m_minQueue;
+        AZStd::deque<AZ::u64> m_maxQueue;
+
+        //! Ring buffers of decimated values for plotting. The point for block B is stored at B % m_plotCapacity.
+        AZStd::vector<float> m_plotValueLog;
+        AZStd::vector<float> m_plotAverageLog;
+
         float m_timeSinceLastDisplayUpdate = 0.0f;
-        int m_samplesSinceLastDisplayUpdate = 0;
+        AZStd::size_t m_samplesSinceLastDisplayUpdate = 0;
 
         float m_displayedAverage = 0.0f;
         float m_displayedMinimum = 0.0f;
@@ -0,0 +1,18 @@
+#
+# Copyright (c) Contributors to the Open 3D Engine Project.
+# For complete copyright and license terms please see the LICENSE at the root of this distribution.
+#
+# SPDX-License-Identifier: Apache-2.0 OR MIT
+#
+#
+
+set(FILES
+    Source/Automation/BaselineImageCache.cpp
+    Source/Automation/BaselineImageCache.h
+    Source/Automation/ImageComparisonConfig.h
+    Source/Automation/ImageComparisonConfig.cpp
+    Source/Automation/ImageDiff.cpp
+    Source/Automation/ImageDiff.h
+    Source/Automation/ScreenshotComparison.cpp
+    Source/Automation/ScreenshotComparison.h
+)
@@ -20,13 +20,17 @@ set(FILES
     Source/SampleComponentConfig.h
     Source/Automation/AssetStatusTracker.cpp
     Source/Automation/AssetStatusTracker.h
-    Source/Automation/ImageComparisonConfig.h
-    Source/Automation/ImageComparisonConfig.cpp
+    Source/Automation/FrameTimingRecorder.cpp
+    Source/Automation/FrameTimingRecorder.h
     Source/Automation/PrecommitWizardSettings.h
     Source/Automation/ScriptableImGui.cpp
     Source/Automation/ScriptableImGui.h
     Source/Automation/ScriptManager.cpp
     Source/Automation/ScriptManager.h
+    Source/Automation/ScriptOperationProfiler.cpp
+    Source/Automation/ScriptOperationProfiler.h
+    Source/Automation/ScriptOperationQueue.cpp
+    Source/Automation/ScriptOperationQueue.h
     Source/Automation/ScriptRepeaterBus.h
     Source/Automation/ScriptRunnerBus.h
     Source/Automation/ScriptReporter.cpp
@@ -154,6 +158,10 @@ set(FILES
     Source/ParallaxMappingExampleComponent.h
     Source/ProceduralSkinnedMesh.cpp
     Source/ProceduralSkinnedMesh.h
+    Source/ProceduralSkinnedMeshCompactStreams.cpp
+    Source/ProceduralSkinnedMeshCompactStreams.h
+    Source/ProceduralSkinnedMeshCpuSkinning.cpp
+    Source/ProceduralSkinnedMeshCpuSkinning.h
     Source/ProceduralSkinnedMeshUtils.cpp
     Source/ProceduralSkinnedMeshUtils.h
     Source/ReadbackExampleComponent.cpp
@@ -184,6 +192,12 @@ set(FILES
     Source/TransparencyExampleComponent.h
     Source/ShaderReloadTestComponent.cpp
     Source/ShaderReloadTestComponent.h
+    Source/Utils/BenchmarkHarness.cpp
+    Source/Utils/BenchmarkHarness.h
+    Source/Utils/CameraPath.cpp
+    Source/Utils/CameraPath.h
+    Source/Utils/FrameTimeHistogram.cpp
+    Source/Utils/FrameTimeHistogram.h
     Source/Utils/ImGuiAssetBrowser.cpp
     Source/Utils/ImGuiAssetBrowser.h
     Source/Utils/ImGuiHistogramQueue.cpp
@@ -167,6 +167,7 @@ namespace AtomSampleViewer
             constexpr const char* testSuiteSwitch = "runtestsuite";
             constexpr const char* testExitSwitch = "exitontestend";
             constexpr const char* testRandomSeed = "randomtestseed";
+            constexpr const char* testShard = "testshard";
 
             bool exitOnTestEnd = commandLine.HasSwitch(testExitSwitch);
 
@@ -180,7 +181,21 @@ namespace AtomSampleViewer
                     randomSeed = atoi(commandLine.GetSwitchValue(testRandomSeed, 0).c_str());
                 }
 
-                SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequestBus::Events::RunMainTestSuite, testSuitePath, exitOnTestEnd, randomSeed);
+                // "--testshard i/n" runs the i-th of n parts of the suite, with i from 0 to n - 1
+                int shardIndex = 0;
+                int shardCount = 1;
+                if (commandLine.HasSwitch(testShard))
+                {
+                    const AZStd::string& shardValue = commandLine.GetSwitchValue(testShard, 0);
+                    if (sscanf(shardValue.c_str(), "%d/%d", &shardIndex, &shardCount) != 2 || shardCount < 1 || shardIndex < 0 || shardIndex >= shardCount)
+                    {
+                        AZ_Error("AtomSampleViewer", false, "Invalid test shard '%s', expected 'index/count' with index from 0 to count - 1. Running the whole suite.", shardValue.c_str());
+                        shardIndex = 0;
+                        shardCount = 1;
+                    }
+                }
+
+                SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequestBus::Events::RunMainTestSuite, testSuitePath, exitOnTestEnd, randomSeed, shardIndex, shardCount);
 
                 m_isTestMode = true;
             }
@@ -0,0 +1,160 @@
+"""
+Copyright (c) Contributors to the Open 3D Engine Project.
+For complete copyright and license terms please see the LICENSE at the root of this distribution.
+
+SPDX-License-Identifier: Apache-2.0 OR MIT
+
+Combines the test results exported by each shard of a test suite run into one report.
+
+Run the shards of a suite in separate AtomSampleViewerStandalone processes, for example:
+    AtomSampleViewerStandalone --runtestsuite scripts/_FullTestSuite_.bv.luac --exitontestend --testshard 0/4
+    ...
+    AtomSampleViewerStandalone --runtestsuite scripts/_FullTestSuite_.bv.luac --exitontestend --testshard 3/4
+Each shard writes TestResults/testResults_shard<index>of<count>.json in the project folder. Then merge them with:
+    python merge_test_results.py TestResults/testResults_shard*.json --output TestResults/testResults.json
+The exit code is 1 if any script had asserts, errors or failed screenshots, or if a shard is missing.
+
+With --runtimes-out, the script runtimes are also written as a Lua table that _FullTestSuite_.bv.lua uses to balance the shards.
+"""
+import argparse
+import json
+import logging
+import sys
+
+logger = logging.getLogger(__name__)
+
+# The fields are omitted from the exported files when they have their default value
+COUNT_FIELDS = ['Asserts', 'Errors', 'ScreenshotErrors', 'Warnings', 'ScreenshotWarnings']
+
+
+def load_results(file_path):
+    """Returns the ExportedTestResults data of a file written by ScriptReporter::ExportTestResultsJson()."""
+    with open(file_path, 'r', encoding='UTF-8') as results_file:
+        document = json.load(results_file)
+    # JsonSerializationUtils wraps the object in a header
+    return document.get('ClassData', document)
+
+
+def merge_results(results_list, file_paths):
+    """Concatenates the scripts of all the shards and checks that every shard of the run is present."""
+    shard_counts = {results.get('ShardCount', 1) for results in results_list}
+    if len(shard_counts) != 1:
+        logger.error(f'The results come from runs with different shard counts: {sorted(shard_counts)}')
+        return None, False
+    shard_count = shard_counts.pop()
+
+    merged = {'ShardCount': shard_count, 'Shards': [], 'Scripts': []}
+    found_shards = set()
+    for results, file_path in zip(results_list, file_paths):
+        shard_index = results.get('ShardIndex', 0)
+        if shard_index in found_shards:
+            logger.error(f'Shard {shard_index} is in more than one file, including {file_path}')
+            return None, False
+        found_shards.add(shard_index)
+
+        scripts = results.get('Scripts', [])
+        merged['Shards'].append({'ShardIndex': shard_index, 'File': file_path, 'ScriptCount': len(scripts)})
+        for script in scripts:
+            merged_script = dict(script)
+            merged_script['ShardIndex'] = shard_index
+            merged['Scripts'].append(merged_script)
+
+    merged['Shards'].sort(key=lambda shard: shard['ShardIndex'])
+
+    missing_shards = sorted(set(range(shard_count)) - found_shards)
+    if missing_shards:
+        logger.error(f'Missing results for shards {missing_shards} of {shard_count}')
+    return merged, not missing_shards
+
+
+def summarize(merged):
+    """Adds the totals of all the scripts to the merged report and returns whether every script passed."""
+    totals = {field: 0 for field in COUNT_FIELDS}
+    totals['Screenshots'] = 0
+    totals['ScreenshotsFailed'] = 0
+    failed_scripts = []
+
+    for script in merged['Scripts']:
+        for field in COUNT_FIELDS:
+            totals[field] += script.get(field, 0)
+        screenshots = script.get('Screenshots', [])
+        totals['Screenshots'] += len(screenshots)
+        totals['ScreenshotsFailed'] += sum(1 for screenshot in screenshots if not screenshot.get('Passed', False))
+
+        if script.get('Asserts', 0) > 0 or script.get('Errors', 0) > 0 or script.get('ScreenshotErrors', 0) > 0:
+            failed_scripts.append(script)
+
+    merged['Totals'] = totals
+
+    for script in failed_scripts:
+        logger.error(f"Test failure {script.get('ScriptAssetPath', '')} (shard {script['ShardIndex']}): asserts {script.get('Asserts', 0)}, "
+                     f"general errors {script.get('Errors', 0)}, screenshot failures {script.get('ScreenshotErrors', 0)}")
+    logger.info(f"{len(merged['Scripts'])} scripts in {len(merged['Shards'])} shards, {len(failed_scripts)} failed. "
+                f"Screenshots: {totals['Screenshots']}, failed: {totals['ScreenshotsFailed']}")
+    return not failed_scripts
+
+
+def write_runtimes(merged, file_path):
+    """Writes the average runtime of every script as the Lua table that _FullTestSuite_.bv.lua loads from TestSuiteRuntimes.lua."""
+    durations = {}
+    for script in merged['Scripts']:
+        durations.setdefault(script.get('ScriptAssetPath', ''), []).append(script.get('DurationSeconds', 0.0))
+
+    lines = [
+        '----------------------------------------------------------------------------------------------------',
+        '--',
+        '-- Copyright (c) Contributors to the Open 3D Engine Project.',
+        '-- For complete copyright and license terms please see the LICENSE at the root of this distribution.',
+        '--',
+        '-- SPDX-License-Identifier: Apache-2.0 OR MIT',
+        '--',
+        '--',
+        '--',
+        '----------------------------------------------------------------------------------------------------',
+        '',
+        '-- Runtime in seconds of the scripts in _FullTestSuite_.bv.lua, used to split the suite into shards that take about the same time.',
+        '-- Regenerate it from the results of a suite run with:',
+        '--   python Standalone/PythonTests/Automated/merge_test_results.py TestResults/testResults_shard*.json --runtimes-out scripts/TestSuiteRuntimes.lua',
+        '-- Scripts that are missing are assumed to take the average time, or defaultScriptRuntime when the table is empty.',
+        'g_testSuiteRuntimes = {',
+    ]
+    for script_path in sorted(durations):
+        if script_path:
+            average = sum(durations[script_path]) / len(durations[script_path])
+            lines.append(f"    ['{script_path}'] = {average:.1f},")
+    lines.append('}')
+
+    with open(file_path, 'w', encoding='UTF-8', newline='\n') as runtimes_file:
+        runtimes_file.write('\n'.join(lines) + '\n')
+    logger.info(f'Script runtimes written to {file_path}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Merges the test results of the shards of an AtomSampleViewer test suite run.')
+    parser.add_argument('results', nargs='+', help='The testResults_shard<index>of<count>.json files of every shard')
+    parser.add_argument('--output', help='Path of the merged report')
+    parser.add_argument('--runtimes-out', help='Path of a Lua file to write the script runtimes to, usually scripts/TestSuiteRuntimes.lua')
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO, format='%(levelname)s: %(message)s')
+
+    results_list = [load_results(file_path) for file_path in args.results]
+    merged, all_shards_found = merge_results(results_list, args.results)
+    if merged is None:
+        return 1
+
+    passed = summarize(merged)
+
+    if args.output:
+        with open(args.output, 'w', encoding='UTF-8') as output_file:
+            json.dump(merged, output_file, indent=4)
+        logger.info(f'Merged report written to {args.output}')
+
+    if args.runtimes_out:
+        write_runtimes(merged, args.runtimes_out)
+
+    return 0 if passed and all_shards_found else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
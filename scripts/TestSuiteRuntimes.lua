@@ -0,0 +1,18 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+
+-- Runtime in seconds of the scripts in _FullTestSuite_.bv.lua, used to split the suite into shards that take about the same time.
+-- Regenerate it from the results of a suite run with:
+--   python Standalone/PythonTests/Automated/merge_test_results.py TestResults/testResults_shard*.json --runtimes-out scripts/TestSuiteRuntimes.lua
+-- Scripts that are missing are assumed to take the average time, or defaultScriptRuntime when the table is empty.
+-- The table has not been recorded yet, so until it is, every test gets the same runtime and the shards are balanced by test count.
+g_testSuiteRuntimes = {
+}
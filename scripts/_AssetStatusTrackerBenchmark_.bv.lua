@@ -0,0 +1,23 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+-- Measures the AssetStatusTracker event path: threads push asset status events, then ProcessEvents() applies them.
+-- The timings are printed to the log.
+EVENT_COUNT = 100000
+THREAD_COUNT = 8
+
+-- Every event fits in the lock-free queue
+BenchmarkAssetStatusTracker(EVENT_COUNT, THREAD_COUNT, 128 * 1024)
+-- The default capacity, which most of the events fit in
+BenchmarkAssetStatusTracker(EVENT_COUNT, THREAD_COUNT, 64 * 1024)
+-- Most of the events go to the mutex-protected overflow list
+BenchmarkAssetStatusTracker(EVENT_COUNT, THREAD_COUNT, 1024)
+
+Print('AssetStatusTracker benchmark complete.')
@@ -9,7 +9,6 @@
 --
 ----------------------------------------------------------------------------------------------------
 g_baseFolder = ResolvePath('@user@/scripts/PerformanceBenchmarks/')
-IDLE_COUNT = 100
 FRAME_COUNT = 100
 SAMPLES_TO_RUN = {
     {prefix = 'RPI', name = 'CullingAndLod', width = 1400, height = 800},
@@ -27,15 +26,11 @@ for index, sample in ipairs(SAMPLES_TO_RUN) do
 
     output_path = g_baseFolder .. sample['name']
     CaptureBenchmarkMetadata(sample['name'], output_path .. '/benchmark_metadata.json')
-    Print('Idling for ' .. tostring(IDLE_COUNT) .. ' frames..')
-    IdleFrames(IDLE_COUNT)
+    Print('Idling until the frame time is stable..')
+    IdleUntilStable()
     Print('Capturing timestamps for ' .. tostring(FRAME_COUNT) .. ' frames...')
-    for i = 1,FRAME_COUNT do
-        frame_timestamps = output_path .. '/frame' .. tostring(i) .. '_timestamps.json'
-        cpu_timings = output_path .. '/cpu_frame' .. tostring(i) .. '_time.json'
-        CapturePassTimestamp(frame_timestamps)
-        CaptureCpuFrameTime(cpu_timings)
-    end
+    CapturePassTimestamps(FRAME_COUNT, output_path .. '/pass_timestamps.json')
+    CaptureCpuFrameTimes(FRAME_COUNT, output_path .. '/cpu_frame_times.json')
 end
 
 Print('Capturing complete.')
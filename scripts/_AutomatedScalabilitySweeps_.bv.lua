@@ -0,0 +1,29 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+-- Measures how the frame time of a few samples scales with their main cost parameter.
+-- Each sweep writes one CSV with a row per value to @user@/scripts/PerformanceBenchmarks/<sample>/sweep_<parameter>.csv
+-- The setup fields are clicked once the sample is open, for samples that hide the parameter's control
+FRAME_COUNT = 100
+SWEEPS_TO_RUN = {
+    {sample = 'Performance/100KDrawable_SingleView', parameter = '##LatticeWidth', values = {5, 10, 20, 30, 40, 50}, width = 800, height = 600, setup = {'Reveal Sidebar'}},
+    {sample = 'Features/LightCulling', parameter = 'Point Lights/Point light count', values = {0, 50, 100, 200, 400, 800}, width = 800, height = 600},
+    {sample = 'Features/SkinnedMesh', parameter = 'Segments Per-Mesh', values = {2, 16, 64, 256, 1024, 2048}, width = 800, height = 600}
+}
+
+Print('Running ' .. tostring(#SWEEPS_TO_RUN) .. ' scalability sweeps')
+for index, sweep in ipairs(SWEEPS_TO_RUN) do
+    Print('Sweeping ' .. sweep['parameter'] .. ' of ' .. sweep['sample'])
+    ResizeViewport(sweep['width'], sweep['height'])
+    SweepBenchmark(sweep['sample'], sweep['parameter'], sweep['values'], FRAME_COUNT, sweep['setup'] or {})
+end
+
+Print('Sweeps complete.')
+OpenSample(nil)
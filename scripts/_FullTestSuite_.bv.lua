@@ -16,16 +16,23 @@
 -- NOTE: If the random seed is zero, then the order is not shuffled at all.
 -- The seed can be provided either in imGui or via commandline switch --randomtestseed
 
+-- The suite can also be split into shards that run in separate processes, with the commandline switch --testshard index/count.
+-- Tests are assigned to shards by their runtime in TestSuiteRuntimes.lua, so every shard takes about the same time.
+-- While that table is empty, every test is given defaultScriptRuntime, so the shards only get the same number of tests.
+-- Every shard exports its results to TestResults/testResults_shard<index>of<count>.json, which can be combined with
+-- Standalone/PythonTests/Automated/merge_test_results.py. That tool also regenerates TestSuiteRuntimes.lua.
+
 
 -- Fast check for a sample which doesn't have a dedicated test script
+-- These don't have their own script report, so their runtime isn't recorded. The estimate is the idle time plus loading the sample.
 function FastCheckSample(sampleName)
-    return function()
+    return {name = 'FastCheck ' .. sampleName, estimate = 4, run = function()
         Print("========= Begin Fast-check " .. sampleName .. " =========")
         OpenSample(sampleName)
         IdleSeconds(2) 
         OpenSample(nil)
         Print("========= End Fast-check " .. sampleName .. " =========")
-    end
+    end}
 end
 
 -- Test helper functions
@@ -36,12 +43,73 @@ function random_shuffle(list)
     end
 end
 
--- A helper wrapper to create a lambda-like behavior in Lua, this allows us to create a table of functions that call various tests
+-- Assumed runtime in seconds of a test script when TestSuiteRuntimes.lua has no recorded runtimes. Test scripts open several samples and
+-- compare screenshots, so this must stay well above the FastCheckSample estimate or the shards would be balanced on the wrong tests.
+defaultScriptRuntime = 60
+
+-- Returns the tests that belong to the shard, assigning each test to the least loaded shard from the longest test to the shortest.
+-- Every shard computes the same assignment because the runtimes come from the same file and ties are broken by name.
+function select_shard(list, shardIndex, shardCount, runtimes)
+    -- Tests without a recorded runtime or an estimate are assumed to take the average recorded time
+    local knownTotal = 0
+    local knownCount = 0
+    for _, test in ipairs(list) do
+        if runtimes[test.name] then
+            knownTotal = knownTotal + runtimes[test.name]
+            knownCount = knownCount + 1
+        end
+    end
+    local defaultRuntime = defaultScriptRuntime
+    if knownCount > 0 then
+        defaultRuntime = knownTotal / knownCount
+    end
+
+    local sorted = {}
+    for _, test in ipairs(list) do
+        table.insert(sorted, {test = test, runtime = runtimes[test.name] or test.estimate or defaultRuntime})
+    end
+    table.sort(sorted, function(a, b)
+        if a.runtime ~= b.runtime then
+            return a.runtime > b.runtime
+        end
+        return a.test.name < b.test.name
+    end)
+
+    local loads = {}
+    for shard = 1, shardCount do
+        loads[shard] = 0
+    end
+
+    local selected = {}
+    for _, entry in ipairs(sorted) do
+        local leastLoaded = 1
+        for shard = 2, shardCount do
+            if loads[shard] < loads[leastLoaded] then
+                leastLoaded = shard
+            end
+        end
+        loads[leastLoaded] = loads[leastLoaded] + entry.runtime
+        if leastLoaded == shardIndex + 1 then
+            table.insert(selected, entry.test)
+        end
+    end
+
+    -- Keep the original order within the shard
+    local order = {}
+    for index, test in ipairs(list) do
+        order[test] = index
+    end
+    table.sort(selected, function(a, b) return order[a] < order[b] end)
+
+    return selected, loads[shardIndex + 1]
+end
+
+-- A helper wrapper to create a lambda-like behavior in Lua, this allows us to create a table of named functions that call various tests
 function RunScriptWrapper(name)
-    return function() RunScript(name) end
+    return {name = name, run = function() RunScript(name) end}
 end
 
--- A table of lambda-like functions that invoke various tests. This table is shuffled if a random seed is provided below.
+-- A table of named lambda-like functions that invoke various tests. This table is sharded and shuffled below.
 tests= {
     RunScriptWrapper('scripts/decals.bv.luac'),
     RunScriptWrapper('scripts/dynamicdraw.bv.luac'),
@@ -120,6 +188,14 @@ if (GetRenderApiName() ~= "dx12") then
     table.insert(tests, FastCheckSample('RHI/Subpass'))
 end
 
+shardCount = GetTestShardCount()
+if (shardCount > 1) then
+    shardIndex = GetTestShardIndex()
+    RunScript('scripts/TestSuiteRuntimes.luac')
+    tests, shardRuntime = select_shard(tests, shardIndex, shardCount, g_testSuiteRuntimes or {})
+    Print("========= Running shard " .. shardIndex .. " of " .. shardCount .. ": " .. #tests .. " tests, about " .. math.floor(shardRuntime) .. " seconds =========")
+end
+
 seed = GetRandomTestSeed()
 if (seed == 0) then
     Print("========= A random seed was not provided, running the tests in the original order =========")
@@ -130,5 +206,5 @@ else
 end
 
 for k,test in pairs(tests) do
-    test()
+    test.run()
 end